@@ -0,0 +1,334 @@
+#include "C11ColumnFile.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "C11ColumnFile.cpp needs mmap from a POSIX system"
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    const char columnFileMagic[8] = {'C', '1', '1', 'U', 'C', 'O', 'L', '1'};
+    const std::uint32_t columnFileVersion = 1;
+    const std::uint32_t byteOrderMark = 0x01020304;
+    /// A page, so the mapped values are aligned for any vector instruction.
+    const std::uint64_t payloadOffset = 4096;
+    const unsigned userLane = BasicUnit::capacity - 1;
+
+    struct ColumnFileHeader
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint64_t payload;
+        std::uint64_t rows;
+        std::uint64_t chunkRows;
+        std::uint64_t index;
+        std::int8_t exponents[BasicUnit::capacity];
+        char userSymbol[24];
+        char displaySymbol[48];
+    };
+
+    static_assert(sizeof(ColumnFileHeader) == 128, "The column file header has a fixed layout");
+
+    [[noreturn]] void fail(const std::string& what, const std::string& path)
+    {
+        throw std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+    }
+
+    [[noreturn]] void invalid(const std::string& path)
+    {
+        throw std::runtime_error(path + " is not a valid C11Units column file");
+    }
+
+    class FileDescriptor
+    {
+    public:
+        FileDescriptor(const std::string& path, int flags) : fd(::open(path.c_str(), flags, 0644))
+        {
+            if(fd < 0)
+                fail("Cannot open", path);
+        }
+
+        ~FileDescriptor()
+        {
+            ::close(fd);
+        }
+
+        FileDescriptor(const FileDescriptor&) = delete;
+        FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+        void write(const void* data, std::size_t size, std::uint64_t offset, const std::string& path)
+        {
+            const char* bytes = static_cast<const char*>(data);
+            while(size > 0)
+            {
+                ssize_t written = ::pwrite(fd, bytes, size, offset);
+                if(written < 0 && errno == EINTR)
+                    continue;
+                if(written <= 0)
+                    fail("Cannot write", path);
+                bytes += written;
+                size -= written;
+                offset += written;
+            }
+        }
+
+        void read(void* data, std::size_t size, std::uint64_t offset, const std::string& path)
+        {
+            char* bytes = static_cast<char*>(data);
+            while(size > 0)
+            {
+                ssize_t got = ::pread(fd, bytes, size, offset);
+                if(got < 0 && errno == EINTR)
+                    continue;
+                if(got < 0)
+                    fail("Cannot read", path);
+                if(got == 0)
+                    invalid(path);
+                bytes += got;
+                size -= got;
+                offset += got;
+            }
+        }
+
+        void resize(std::uint64_t size, const std::string& path)
+        {
+            if(::ftruncate(fd, size) != 0)
+                fail("Cannot resize", path);
+        }
+
+        std::uint64_t size(const std::string& path)
+        {
+            struct stat status;
+            if(::fstat(fd, &status) != 0)
+                fail("Cannot open", path);
+            return status.st_size;
+        }
+
+        void sync(const std::string& path)
+        {
+            if(::fsync(fd) != 0)
+                fail("Cannot sync", path);
+        }
+
+        int fd;
+    };
+
+    std::uint64_t chunksFor(std::uint64_t rows, std::uint64_t chunkRows)
+    {
+        return chunkRows == 0 ? 0 : (rows + chunkRows - 1) / chunkRows;
+    }
+
+    ColumnFileHeader headerFor(Unit unit, std::size_t chunkRows, const std::string& path)
+    {
+        ColumnFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, columnFileMagic, sizeof(header.magic));
+        header.version = columnFileVersion;
+        header.byteOrder = byteOrderMark;
+        header.payload = payloadOffset;
+        header.chunkRows = chunkRows;
+        for(unsigned i = 0; i < BasicUnit::capacity; i++)
+            header.exponents[i] = static_cast<std::int8_t>(unit.exponent(i));
+        if(unit.exponent(userLane) != 0)
+        {
+            const char* symbol = BasicUnit::symbol(userLane);
+            if(std::strlen(symbol) >= sizeof(header.userSymbol))
+                throw std::runtime_error("Unit symbol " + std::string(symbol) + " is too long for " + path);
+            std::strcpy(header.userSymbol, symbol);
+        }
+        unit.displaySymbol().copy(header.displaySymbol, sizeof(header.displaySymbol) - 1);
+        return header;
+    }
+
+    /// A symbol that does not fit into the symbol table is a format error
+    /// like any other, not a unit error.
+    Unit unitOf(const ColumnFileHeader& header, const std::string& path)
+    {
+        std::uint64_t signature = 0;
+        for(unsigned i = 0; i < userLane; i++)
+            signature |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(header.exponents[i])) << (8 * i);
+        if(header.exponents[userLane] != 0)
+        {
+            std::string symbol(header.userSymbol, strnlen(header.userSymbol, sizeof(header.userSymbol)));
+            unsigned lane = 0;
+            try
+            {
+                lane = BasicUnit::intern(symbol);
+            }
+            catch(const UnitErrorException&)
+            {
+                invalid(path);
+            }
+            signature |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(header.exponents[userLane])) << (8 * lane);
+        }
+        return Unit(signature);
+    }
+
+    bool valid(const ColumnFileHeader& header, std::uint64_t size)
+    {
+        if(std::memcmp(header.magic, columnFileMagic, sizeof(header.magic)) != 0 || header.version != columnFileVersion
+           || header.byteOrder != byteOrderMark || header.payload < sizeof(header) || header.payload % sizeof(double) != 0
+           || header.payload > size || header.rows > (size - header.payload) / sizeof(double))
+            return false;
+        if(header.chunkRows == 0)
+            return true;
+        const std::uint64_t chunks = chunksFor(header.rows, header.chunkRows);
+        return header.index >= header.payload + header.rows * sizeof(double) && header.index <= size
+               && chunks <= (size - header.index) / sizeof(ColumnFile::ChunkSummary);
+    }
+
+    void summarize(const double* values, std::size_t n, ColumnFile::ChunkSummary& summary)
+    {
+        for(std::size_t i = 0; i < n; i++)
+        {
+            summary.min = values[i] < summary.min ? values[i] : summary.min;
+            summary.max = values[i] > summary.max ? values[i] : summary.max;
+        }
+    }
+
+    /// Every step leaves a valid file behind and is synced before the next
+    /// one, so an interrupted append leaves the old rows intact:
+    ///
+    /// 1. The new index goes where the old header does not look, into the
+    ///    gap before the old index or after it.
+    /// 2. If the new values would overwrite the old index, a copy of it is
+    ///    written past the new index and the header is pointed at the copy.
+    /// 3. The values are written, then the header with the new row count.
+    void appendRows(FileDescriptor& file, ColumnFileHeader& header, const QuantityView& values, const std::string& path)
+    {
+        const std::uint64_t size = file.size(path);
+        std::vector<ColumnFile::ChunkSummary> old(chunksFor(header.rows, header.chunkRows));
+        if(!old.empty())
+            file.read(old.data(), old.size() * sizeof(old[0]), header.index, path);
+
+        std::vector<ColumnFile::ChunkSummary> index(old);
+        for(std::size_t i = 0; header.chunkRows != 0 && i < values.size(); )
+        {
+            const std::uint64_t row = header.rows + i;
+            const std::size_t end = std::min<std::uint64_t>(values.size(), i + header.chunkRows - row % header.chunkRows);
+            if(row / header.chunkRows == index.size())
+            {
+                ColumnFile::ChunkSummary empty = {std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};
+                index.push_back(empty);
+            }
+            summarize(values.data() + i, end - i, index.back());
+            i = end;
+        }
+
+        const std::uint64_t begin = header.payload + header.rows * sizeof(double);
+        const std::uint64_t end = begin + values.size() * sizeof(double);
+        const std::uint64_t indexBytes = index.size() * sizeof(index[0]);
+        const std::uint64_t oldIndexEnd = header.index + old.size() * sizeof(old[0]);
+        /// Without chunks the index is empty and simply ends the values.
+        std::uint64_t indexAt = end;
+        if(!index.empty())
+        {
+            indexAt = !old.empty() && end + indexBytes <= header.index ? end : std::max(end, oldIndexEnd);
+            file.write(index.data(), indexBytes, indexAt, path);
+        }
+        const bool moved = !old.empty() && end > header.index;
+        if(moved)
+        {
+            ColumnFileHeader copy = header;
+            copy.index = indexAt + indexBytes;
+            file.write(old.data(), old.size() * sizeof(old[0]), copy.index, path);
+            file.sync(path);
+            file.write(&copy, sizeof(copy), 0, path);
+        }
+        file.sync(path);
+
+        file.write(values.data(), values.size() * sizeof(double), begin, path);
+        file.sync(path);
+        header.rows += values.size();
+        header.index = indexAt;
+        file.write(&header, sizeof(header), 0, path);
+        file.sync(path);
+        /// Drops the copy if it grew the file. The file never shrinks below
+        /// its old size, which a mapping may still cover.
+        if(moved && indexAt + indexBytes > size)
+            file.resize(indexAt + indexBytes, path);
+    }
+}
+
+const std::size_t ColumnFile::defaultChunkRows;
+
+ColumnFile::ColumnFile(const std::string& path) : mapping(nullptr), length(0), values(nullptr), rows(0), rowsPerChunk(0),
+                                                  chunks(nullptr), unit({})
+{
+    FileDescriptor file(path, O_RDONLY);
+    length = file.size(path);
+    if(length < sizeof(ColumnFileHeader))
+        invalid(path);
+    mapping = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, file.fd, 0);
+    if(mapping == MAP_FAILED)
+        fail("Cannot map", path);
+
+    const char* base = static_cast<const char*>(mapping);
+    const ColumnFileHeader& header = *reinterpret_cast<const ColumnFileHeader*>(base);
+    try
+    {
+        if(!valid(header, length))
+            invalid(path);
+        unit = unitOf(header, path);
+    }
+    catch(...)
+    {
+        ::munmap(mapping, length);
+        throw;
+    }
+    values = reinterpret_cast<const double*>(base + header.payload);
+    rows = header.rows;
+    rowsPerChunk = header.chunkRows;
+    chunks = rowsPerChunk != 0 ? reinterpret_cast<const ChunkSummary*>(base + header.index) : nullptr;
+    displaySymbol.assign(header.displaySymbol, strnlen(header.displaySymbol, sizeof(header.displaySymbol)));
+}
+
+ColumnFile::~ColumnFile()
+{
+    ::munmap(mapping, length);
+}
+
+std::size_t ColumnFile::chunkCount() const
+{
+    return chunksFor(rows, rowsPerChunk);
+}
+
+ColumnFile::ChunkSummary ColumnFile::chunk(std::size_t i) const
+{
+    return chunks[i];
+}
+
+void ColumnFile::write(const std::string& path, const QuantityView& values, std::size_t chunkRows)
+{
+    ColumnFileHeader header = headerFor(values.getUnit(), chunkRows, path);
+    FileDescriptor file(path, O_RDWR | O_CREAT | O_TRUNC);
+    file.resize(payloadOffset, path);
+    appendRows(file, header, values, path);
+}
+
+void ColumnFile::append(const std::string& path, const QuantityView& values)
+{
+    FileDescriptor file(path, O_RDWR);
+    const std::uint64_t size = file.size(path);
+    ColumnFileHeader header;
+    if(size < sizeof(header))
+        invalid(path);
+    file.read(&header, sizeof(header), 0, path);
+    if(!valid(header, size))
+        invalid(path);
+    if(!unitOf(header, path).compatible(values.getUnit()))
+        throw std::runtime_error("The unit of " + path + " does not match the appended values");
+    appendRows(file, header, values, path);
+}
@@ -0,0 +1,92 @@
+#ifndef C11COLUMNFILE_H_INCLUDED
+#define C11COLUMNFILE_H_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include "C11QuantityArray.h"
+
+/// A file holding one column of doubles and its Unit. Opening maps the file
+/// into memory, so the values are not read until they are used and the file
+/// can be far larger than RAM.
+///
+/// Layout, in the byte order of the machine that wrote it:
+///
+///     0     magic "C11UCOL1", version, byte order mark
+///     16    payload offset, row count, rows per chunk, index offset
+///     48    exponent of A, Cd, K, kg, m, mol, s and a user defined symbol
+///     56    name of the user defined symbol, NUL padded
+///     80    display symbol, e.g. "Pa", NUL padded
+///     4096  the values
+///     ...   per chunk of rows the minimum and maximum value, at the index
+///           offset, which may leave a gap after the values
+///
+/// I/O and format errors throw std::runtime_error.
+class ColumnFile
+{
+public:
+    static const std::size_t defaultChunkRows = 1 << 16;
+
+    /// NaNs are skipped; a chunk without numbers has min > max.
+    struct ChunkSummary
+    {
+        double min;
+        double max;
+    };
+
+    /// Maps the file read-only. Rows appended afterwards are not visible,
+    /// and an append may overwrite the chunk index this mapping reads, so
+    /// reopen the file before using chunk() after an append.
+    explicit ColumnFile(const std::string& path);
+    ~ColumnFile();
+
+    ColumnFile(const ColumnFile&) = delete;
+    ColumnFile& operator=(const ColumnFile&) = delete;
+
+    Unit getUnit() const
+    {
+        return unit;
+    }
+
+    const std::string& getDisplaySymbol() const
+    {
+        return displaySymbol;
+    }
+
+    std::size_t size() const
+    {
+        return rows;
+    }
+
+    /// The mapped values, valid as long as this ColumnFile.
+    QuantityView view() const
+    {
+        return QuantityView(values, rows, unit);
+    }
+
+    std::size_t chunkRows() const
+    {
+        return rowsPerChunk;
+    }
+
+    std::size_t chunkCount() const;
+    ChunkSummary chunk(std::size_t i) const;
+
+    /// Creates or replaces path. chunkRows = 0 writes no chunk index.
+    static void write(const std::string& path, const QuantityView& values, std::size_t chunkRows = defaultChunkRows);
+    /// Appends to an existing file. Different units throw
+    /// std::runtime_error in every UnitErrorPolicy mode, since no rows
+    /// would be written otherwise.
+    static void append(const std::string& path, const QuantityView& values);
+
+private:
+    void* mapping;
+    std::size_t length;
+    const double* values;
+    std::size_t rows;
+    std::size_t rowsPerChunk;
+    const ChunkSummary* chunks;
+    Unit unit;
+    std::string displaySymbol;
+};
+
+#endif // C11COLUMNFILE_H_INCLUDED
@@ -0,0 +1,350 @@
+#include "C11Csv.h"
+#include "C11Parallel.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /// Consecutive cells of compatible units, starting at values[begin].
+    struct UnitRun
+    {
+        std::size_t begin;
+        Unit unit;
+    };
+
+    /// The values of one column parsed from one chunk. Whether a unit fits
+    /// the column is only known once the chunks before are merged, so the
+    /// parser keeps the runs of units and the merge drops the ones that do
+    /// not fit.
+    struct ColumnChunk
+    {
+        ColumnChunk() : suffixLength(0), scale(1.), offset(0.), suffixUnit({}) {}
+
+        std::vector<double> values;
+        std::vector<UnitRun> runs;
+
+        /// The last suffix and what it resolved to.
+        char suffix[16];
+        std::size_t suffixLength;
+        double scale;
+        double offset;
+        Unit suffixUnit;
+    };
+
+    struct Chunk
+    {
+        const char* begin;
+        const char* end;
+        std::uint64_t offset;
+    };
+
+    class ChunkParser
+    {
+    public:
+        ChunkParser(const Chunk& chunk, char delimiter, std::vector<ColumnChunk>& columns)
+            : chunk(chunk), delimiter(delimiter), columns(columns) {}
+
+        void parse()
+        {
+            const char* p = chunk.begin;
+            bool reserved = false;
+            while(p < chunk.end)
+            {
+                if(*p == '\n' || *p == '\r')
+                {
+                    p++;
+                    continue;
+                }
+                std::size_t column = 0;
+                for(;;)
+                {
+                    if(column == columns.size())
+                        throw UnitParseError("Too many cells in a row", position(p));
+                    p = cell(p, columns[column++]);
+                    if(p == chunk.end)
+                        break;
+                    if(*p++ == '\n')
+                        break;
+                }
+                for(; column < columns.size(); column++)
+                    columns[column].values.push_back(std::numeric_limits<double>::quiet_NaN());
+                if(!reserved)
+                {
+                    reserve(p);
+                    reserved = true;
+                }
+            }
+        }
+
+    private:
+        /// Guesses the number of rows from the length of the first one.
+        void reserve(const char* firstRowEnd)
+        {
+            const std::size_t rows = (chunk.end - chunk.begin) / (firstRowEnd - chunk.begin) * 5 / 4 + 16;
+            for(ColumnChunk& column : columns)
+                column.values.reserve(rows);
+        }
+
+        bool isBlank(char c) const
+        {
+            return (c == ' ' || c == '\t' || c == '\r') && c != delimiter;
+        }
+
+        bool isCellEnd(const char* p) const
+        {
+            return p == chunk.end || *p == delimiter || *p == '\n';
+        }
+
+        std::uint64_t position(const char* p) const
+        {
+            return chunk.offset + (p - chunk.begin);
+        }
+
+        const char* skipBlanks(const char* p) const
+        {
+            while(p != chunk.end && isBlank(*p))
+                p++;
+            return p;
+        }
+
+        /// Parses one cell and returns the delimiter or line break after it.
+        /// A bare number in a column without suffixes is parsed straight from
+        /// the buffer; blanks, quotes and suffixes take the general path.
+        const char* cell(const char* p, ColumnChunk& column)
+        {
+            double x = 0.;
+            const char* end = parseNumber(p, chunk.end, x);
+            if(end != p && end != chunk.end && (*end == delimiter || *end == '\n') && column.suffixLength == 0
+               && !column.runs.empty())
+            {
+                column.values.push_back(x);
+                return end;
+            }
+            return generalCell(p, column);
+        }
+
+        const char* generalCell(const char* p, ColumnChunk& column)
+        {
+            const char* start = p;
+            p = skipBlanks(p);
+            const bool quoted = p != chunk.end && *p == '"';
+            if(quoted)
+                p = skipBlanks(p + 1);
+
+            double x = 0.;
+            const char* number = p;
+            p = parseNumber(p, chunk.end, x);
+            const bool empty = p == number;
+            p = skipBlanks(p);
+
+            const char* suffix = p;
+            while(!isCellEnd(p) && !isBlank(*p) && *p != '"')
+                p++;
+            const std::size_t length = p - suffix;
+
+            if(quoted && p != chunk.end && *p == '"')
+                p++;
+            p = skipBlanks(p);
+            if(!isCellEnd(p) || (empty && length != 0))
+                throw UnitParseError("Malformed cell", position(start));
+
+            if(empty)
+            {
+                column.values.push_back(std::numeric_limits<double>::quiet_NaN());
+                return p;
+            }
+
+            if(length != column.suffixLength || std::memcmp(suffix, column.suffix, length) != 0)
+                resolve(suffix, length, column, position(suffix));
+            if(column.runs.empty() || !column.runs.back().unit.compatible(column.suffixUnit))
+            {
+                UnitRun run = {column.values.size(), column.suffixUnit};
+                column.runs.push_back(run);
+            }
+            column.values.push_back(column.scale * x + column.offset);
+            return p;
+        }
+
+        static void resolve(const char* suffix, std::size_t length, ColumnChunk& column, std::uint64_t at)
+        {
+            double scale = 1., offset = 0.;
+            Unit unit({});
+            if(length != 0)
+            {
+                const UnitSymbol* symbol = UnitSymbol::find(suffix, length);
+                if(!symbol)
+                    throw UnitParseError("Unknown unit symbol", at);
+                scale = symbol->scale;
+                offset = symbol->offset;
+                unit = symbol->unit;
+            }
+            column.scale = scale;
+            column.offset = offset;
+            column.suffixUnit = unit;
+            /// Suffixes too long for the cache are looked up every time.
+            column.suffixLength = length <= sizeof(column.suffix) ? length : std::numeric_limits<std::size_t>::max();
+            if(length <= sizeof(column.suffix))
+                std::memcpy(column.suffix, suffix, length);
+        }
+
+        const Chunk& chunk;
+        const char delimiter;
+        std::vector<ColumnChunk>& columns;
+    };
+
+    std::vector<std::string> splitHeader(const std::string& line, char delimiter)
+    {
+        std::vector<std::string> names;
+        std::size_t begin = 0;
+        for(;;)
+        {
+            std::size_t end = line.find(delimiter, begin);
+            std::string name = line.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+            const std::size_t first = name.find_first_not_of(" \t\r\"");
+            const std::size_t last = name.find_last_not_of(" \t\r\"");
+            names.push_back(first == std::string::npos ? std::string() : name.substr(first, last - first + 1));
+            if(end == std::string::npos)
+                return names;
+            begin = end + 1;
+        }
+    }
+
+    struct ColumnData
+    {
+        ColumnData() : rows(0), unit({}), known(false) {}
+
+        /// Joins the parts, copying only if there is more than one.
+        std::vector<double> values()
+        {
+            if(parts.size() == 1)
+                return std::move(parts.front());
+            std::vector<double> joined;
+            joined.reserve(rows);
+            for(std::vector<double>& part : parts)
+            {
+                joined.insert(joined.end(), part.begin(), part.end());
+                std::vector<double>().swap(part);
+            }
+            return joined;
+        }
+
+        std::vector<std::vector<double>> parts;
+        std::size_t rows;
+        Unit unit;
+        bool known;
+    };
+}
+
+QuantityTable CsvReader::read(std::istream& in, const CsvOptions& options)
+{
+    std::string first;
+    if(!std::getline(in, first))
+        return QuantityTable();
+    std::vector<std::string> names = splitHeader(first, options.delimiter);
+    std::vector<char> pending;
+    std::uint64_t position = first.size() + 1;
+    if(!options.header)
+    {
+        for(std::size_t i = 0; i < names.size(); i++)
+            names[i] = std::to_string(i);
+        pending.assign(first.begin(), first.end());
+        pending.push_back('\n');
+        position = 0;
+    }
+
+    std::vector<ColumnData> columns(names.size());
+    bool mismatch = false;
+    const std::size_t chunkSize = options.chunkSize > 0 ? options.chunkSize : 1;
+    const std::size_t batch = ThreadPool::global().size();
+    std::vector<std::vector<char>> buffers(batch);
+    std::vector<Chunk> chunks;
+    bool finished = false;
+    while(!finished)
+    {
+        /// The buffers are reused, so they are only allocated and zeroed once.
+        chunks.clear();
+        for(std::size_t b = 0; b < batch && !finished; )
+        {
+            std::vector<char>& buffer = buffers[b];
+            const std::size_t old = pending.size();
+            if(buffer.size() < old + chunkSize)
+                buffer.resize(old + chunkSize);
+            std::copy(pending.begin(), pending.end(), buffer.begin());
+            in.read(buffer.data() + old, chunkSize);
+            const std::size_t size = old + in.gcount();
+            finished = !in;
+
+            std::size_t cut = size;
+            if(!finished)
+            {
+                while(cut > 0 && buffer[cut - 1] != '\n')
+                    cut--;
+                if(cut == 0)
+                {
+                    /// A line longer than a chunk, keep reading.
+                    pending.assign(buffer.begin(), buffer.begin() + size);
+                    continue;
+                }
+            }
+            pending.assign(buffer.begin() + cut, buffer.begin() + size);
+            Chunk chunk = {buffer.data(), buffer.data() + cut, position};
+            chunks.push_back(chunk);
+            position += cut;
+            b++;
+        }
+
+        std::vector<std::vector<ColumnChunk>> parsed(chunks.size(), std::vector<ColumnChunk>(columns.size()));
+        ThreadPool::global().run(chunks.size(), [&](std::size_t i)
+        {
+            ChunkParser(chunks[i], options.delimiter, parsed[i]).parse();
+        });
+
+        for(std::vector<ColumnChunk>& chunk : parsed)
+        {
+            for(std::size_t c = 0; c < columns.size(); c++)
+            {
+                ColumnChunk& part = chunk[c];
+                ColumnData& column = columns[c];
+                for(std::size_t r = 0; r < part.runs.size(); r++)
+                {
+                    const UnitRun& run = part.runs[r];
+                    if(!column.known)
+                    {
+                        column.unit = run.unit;
+                        column.known = true;
+                    }
+                    else if(!column.unit.compatible(run.unit))
+                    {
+                        mismatch = true;
+                        const std::size_t end = r + 1 < part.runs.size() ? part.runs[r + 1].begin : part.values.size();
+                        std::fill(part.values.begin() + run.begin, part.values.begin() + end,
+                                  std::numeric_limits<double>::quiet_NaN());
+                    }
+                }
+                column.rows += part.values.size();
+                column.parts.push_back(std::move(part.values));
+            }
+        }
+    }
+
+    if(mismatch)
+        UnitErrorPolicy::report(unitMismatch, "csv");
+    QuantityTable table;
+    for(std::size_t c = 0; c < columns.size(); c++)
+        table.addColumn(names[c], QuantityArray(columns[c].values(), columns[c].unit));
+    return table;
+}
+
+QuantityTable CsvReader::read(const std::string& path, const CsvOptions& options)
+{
+    std::ifstream in(path, std::ios::binary);
+    if(!in)
+        throw std::runtime_error("Cannot open " + path);
+    return read(in, options);
+}
@@ -0,0 +1,40 @@
+#ifndef C11CSV_H_INCLUDED
+#define C11CSV_H_INCLUDED
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include "C11QuantityTable.h"
+
+struct CsvOptions
+{
+    CsvOptions() : delimiter(','), header(true), chunkSize(1 << 24) {}
+
+    char delimiter;
+    /// Whether the first line names the columns; otherwise they are "0", "1", ...
+    bool header;
+    /// Bytes parsed per task; the input is read in batches of one chunk per thread.
+    std::size_t chunkSize;
+};
+
+/// Reads CSV files with cells like "12.5 km", "3 mus" or "0.2kohm" into a
+/// QuantityTable. The suffix may be any literal of C11UNITS_LITERALS, cells
+/// without one are dimensionless and empty cells become NaN. Values are
+/// stored in SI units; all cells of a column need the same dimension.
+///
+/// The input is streamed in chunks that are parsed on ThreadPool::global().
+/// Cells are parsed in place without allocating and a column remembers its
+/// last suffix, so the symbol table is only consulted when the suffix
+/// changes. Cells must not contain line breaks.
+///
+/// Malformed cells and unknown units throw UnitParseError with the byte
+/// offset of the cell; cells of the wrong dimension go through
+/// UnitErrorPolicy and are NaN if that does not throw.
+class CsvReader
+{
+public:
+    static QuantityTable read(std::istream& in, const CsvOptions& options = CsvOptions());
+    static QuantityTable read(const std::string& path, const CsvOptions& options = CsvOptions());
+};
+
+#endif // C11CSV_H_INCLUDED
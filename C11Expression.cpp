@@ -0,0 +1,445 @@
+#include "C11Expression.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+/// x^n in a formula is PhysicalVariable::pow(), not operator^.
+static_assert((PhysicalVariable(3., Unit({})) ^ 2).getValue() == 3., "operator^ keeps the value");
+
+/// Recursive descent over the formula text. Every subexpression becomes an
+/// Operand that is either a folded constant or a register; constants only
+/// get a register once an instruction needs them.
+class CompiledFormula::Compiler
+{
+public:
+    Compiler(CompiledFormula& formula, const std::string& text, const std::vector<FormulaVariable>& variables)
+        : formula(formula), text(text), variables(variables), position(0)
+    {
+    }
+
+    void compile()
+    {
+        for(const FormulaVariable& variable : variables)
+        {
+            Input input = {1., 0.};
+            Unit unit({});
+            if(!variable.unit.empty())
+            {
+                const UnitSymbol* symbol = UnitSymbol::find(variable.unit);
+                if(!symbol)
+                    throw UnitParseError("Unknown unit symbol", 0);
+                input.scale = symbol->scale;
+                input.offset = symbol->offset;
+                unit = symbol->unit;
+            }
+            formula.inputs.push_back(input);
+            variableUnits.push_back(unit);
+        }
+        formula.registerCount = variables.size();
+
+        Operand result = expression();
+        skipSpace();
+        if(position != text.size())
+            throw UnitParseError("Unexpected character", position);
+        formula.result = registerOf(result);
+        formula.unit = result.unit;
+    }
+
+private:
+    struct Operand
+    {
+        Unit unit;
+        bool constant;
+        double value;
+        std::uint16_t target;
+    };
+
+    static Operand constant(double value, Unit unit)
+    {
+        Operand o = {unit, true, value, 0};
+        return o;
+    }
+
+    static Operand inRegister(std::uint16_t target, Unit unit)
+    {
+        Operand o = {unit, false, 0., target};
+        return o;
+    }
+
+    void skipSpace()
+    {
+        while(position < text.size() && std::isspace(static_cast<unsigned char>(text[position])))
+            position++;
+    }
+
+    bool accept(char c)
+    {
+        skipSpace();
+        if(position < text.size() && text[position] == c)
+        {
+            position++;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c, const char* message)
+    {
+        if(!accept(c))
+            throw UnitParseError(message, position);
+    }
+
+    Operand expression()
+    {
+        Operand left = term();
+        for(;;)
+        {
+            if(accept('+'))
+                left = binary(addition, left, term());
+            else if(accept('-'))
+                left = binary(subtraction, left, term());
+            else
+                return left;
+        }
+    }
+
+    Operand term()
+    {
+        Operand left = unary();
+        for(;;)
+        {
+            if(accept('*'))
+                left = binary(multiplication, left, unary());
+            else if(accept('/'))
+                left = binary(division, left, unary());
+            else
+                return left;
+        }
+    }
+
+    Operand unary()
+    {
+        if(accept('-'))
+        {
+            Operand operand = unary();
+            if(operand.constant)
+                return constant(-operand.value, operand.unit);
+            return emit(negation, operand, 0, operand.unit);
+        }
+        if(accept('+'))
+            return unary();
+        Operand base = primary();
+        if(accept('^'))
+        {
+            signed exponent = integer();
+            if(!base.unit.canPow(exponent))
+                throw unitErrorException;
+            if(base.constant)
+                return constant(std::pow(base.value, exponent), base.unit.pow(exponent));
+            return emit(power, base, exponent, base.unit.pow(exponent));
+        }
+        return base;
+    }
+
+    Operand primary()
+    {
+        skipSpace();
+        if(position == text.size())
+            throw UnitParseError("Unexpected end of formula", position);
+        if(accept('('))
+        {
+            Operand inner = expression();
+            expect(')', "Expected ')'");
+            return inner;
+        }
+        char c = text[position];
+        if(std::isdigit(static_cast<unsigned char>(c)) || c == '.')
+            return number();
+        if(std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+        {
+            std::size_t start = position;
+            std::string name = identifier();
+            if(accept('('))
+                return function(name, start);
+            auto variable = std::find_if(variables.begin(), variables.end(),
+                                         [&name](const FormulaVariable& v) { return v.name == name; });
+            if(variable == variables.end())
+                throw UnitParseError("Unknown variable", start);
+            std::size_t index = variable - variables.begin();
+            return inRegister(static_cast<std::uint16_t>(index), variableUnits[index]);
+        }
+        throw UnitParseError("Unexpected character", position);
+    }
+
+    Operand function(const std::string& name, std::size_t start)
+    {
+        Operand argument = expression();
+        signed n = 2;
+        if(name == "root")
+        {
+            expect(',', "Expected ','");
+            n = integer();
+        }
+        else if(name != "sqrt")
+            throw UnitParseError("Unknown function", start);
+        expect(')', "Expected ')'");
+
+        Unit unit({});
+        if(argument.unit.tryRoot(n, unit) != unitOk)
+            throw unitErrorException;
+        if(argument.constant)
+            return constant(std::pow(argument.value, 1./n), unit);
+        return emit(root, argument, n, unit);
+    }
+
+    Operand number()
+    {
+        const char* begin = text.c_str() + position;
+        double value = 0.;
+        const char* end = parseNumber(begin, text.c_str() + text.size(), value);
+        if(end == begin)
+            throw UnitParseError("Malformed number", position);
+        position += end - begin;
+        if(position < text.size() && text[position] == '_')
+        {
+            std::size_t start = ++position;
+            const UnitSymbol* symbol = UnitSymbol::find(identifier());
+            if(!symbol)
+                throw UnitParseError("Unknown unit symbol", start);
+            PhysicalVariable v = (*symbol)(value);
+            return constant(v.getValue(), v.getUnit());
+        }
+        return constant(value, Unit({}));
+    }
+
+    std::string identifier()
+    {
+        std::size_t start = position;
+        while(position < text.size() && (std::isalnum(static_cast<unsigned char>(text[position])) || text[position] == '_'))
+            position++;
+        if(start == position)
+            throw UnitParseError("Expected a name", position);
+        return text.substr(start, position - start);
+    }
+
+    signed integer()
+    {
+        bool parenthesized = accept('(');
+        bool negative = accept('-');
+        if(!negative)
+            accept('+');
+        skipSpace();
+        std::size_t start = position;
+        signed n = 0;
+        while(position < text.size() && std::isdigit(static_cast<unsigned char>(text[position])) && n < 1000)
+            n = n * 10 + (text[position++] - '0');
+        if(start == position)
+            throw UnitParseError("Expected an integral exponent", position);
+        if(parenthesized)
+            expect(')', "Expected ')'");
+        return negative ? -n : n;
+    }
+
+    Operand binary(Opcode opcode, Operand left, Operand right)
+    {
+        Unit unit({});
+        switch(opcode)
+        {
+        case addition:
+        case subtraction:
+            if(!left.unit.compatible(right.unit))
+                throw unitErrorException;
+            unit = left.unit;
+            break;
+        case multiplication:
+            if(!left.unit.canMultiply(right.unit))
+                throw unitErrorException;
+            unit = left.unit * right.unit;
+            break;
+        default:
+            if(!left.unit.canDivide(right.unit))
+                throw unitErrorException;
+            unit = left.unit / right.unit;
+            break;
+        }
+
+        if(left.constant && right.constant)
+        {
+            double a = left.value, b = right.value;
+            return constant(opcode == addition ? a + b : opcode == subtraction ? a - b :
+                            opcode == multiplication ? a * b : a / b, unit);
+        }
+        std::uint16_t r = registerOf(right);
+        return emit(opcode, left, r, unit);
+    }
+
+    Operand emit(Opcode opcode, Operand left, std::int32_t right, Unit unit)
+    {
+        std::uint16_t l = registerOf(left);
+        release(l);
+        if(opcode != power && opcode != root && opcode != negation)
+            release(static_cast<std::uint16_t>(right));
+        Instruction instruction = {opcode, allocate(), l, right};
+        formula.program.push_back(instruction);
+        return inRegister(instruction.target, unit);
+    }
+
+    std::uint16_t registerOf(const Operand& o)
+    {
+        if(!o.constant)
+            return o.target;
+        Constant c = {fresh(), o.value};
+        formula.constants.push_back(c);
+        return c.target;
+    }
+
+    /// Constants are filled in once per evaluation, so they never share a
+    /// register. Temporaries are reused as soon as their value is consumed.
+    std::uint16_t allocate()
+    {
+        std::uint16_t r;
+        if(!unused.empty())
+        {
+            r = unused.back();
+            unused.pop_back();
+        }
+        else
+            r = fresh();
+        temporaries.push_back(r);
+        return r;
+    }
+
+    std::uint16_t fresh()
+    {
+        if(formula.registerCount > 0xFFFF)
+            throw UnitParseError("Formula too large", position);
+        return static_cast<std::uint16_t>(formula.registerCount++);
+    }
+
+    void release(std::uint16_t r)
+    {
+        auto temporary = std::find(temporaries.begin(), temporaries.end(), r);
+        if(temporary == temporaries.end())
+            return;
+        temporaries.erase(temporary);
+        unused.push_back(r);
+    }
+
+    CompiledFormula& formula;
+    const std::string& text;
+    const std::vector<FormulaVariable>& variables;
+    std::vector<Unit> variableUnits;
+    std::vector<std::uint16_t> temporaries;
+    std::vector<std::uint16_t> unused;
+    std::size_t position;
+};
+
+const std::size_t CompiledFormula::blockSize;
+
+CompiledFormula::CompiledFormula(const std::string& text, const std::vector<FormulaVariable>& variables)
+    : registerCount(0), result(0), unit({})
+{
+    Compiler(*this, text, variables).compile();
+}
+
+Unit CompiledFormula::getUnit() const
+{
+    return unit;
+}
+
+std::size_t CompiledFormula::variableCount() const
+{
+    return inputs.size();
+}
+
+void CompiledFormula::evaluate(std::size_t count, double* results, const double* const* columns) const
+{
+    std::vector<double> storage(registerCount * blockSize);
+    std::vector<const double*> operands(registerCount);
+    for(std::size_t r = 0; r < registerCount; r++)
+        operands[r] = &storage[r * blockSize];
+    for(const Constant& c : constants)
+        std::fill_n(&storage[c.target * blockSize], blockSize, c.value);
+
+    for(std::size_t start = 0; start < count; start += blockSize)
+    {
+        const std::size_t n = std::min(blockSize, count - start);
+
+        /// Columns already in SI units are read in place.
+        for(std::size_t v = 0; v < inputs.size(); v++)
+        {
+            const double* column = columns[v] + start;
+            const Input input = inputs[v];
+            if(input.scale == 1. && input.offset == 0.)
+            {
+                operands[v] = column;
+                continue;
+            }
+            double* t = &storage[v * blockSize];
+            for(std::size_t i = 0; i < n; i++)
+                t[i] = input.scale * column[i] + input.offset;
+            operands[v] = t;
+        }
+
+        for(const Instruction& instruction : program)
+        {
+            double* t = &storage[instruction.target * blockSize];
+            const double* a = operands[instruction.left];
+            const double* b = instruction.opcode <= division ? operands[instruction.right] : a;
+            switch(instruction.opcode)
+            {
+            case addition:
+                for(std::size_t i = 0; i < n; i++)
+                    t[i] = a[i] + b[i];
+                break;
+            case subtraction:
+                for(std::size_t i = 0; i < n; i++)
+                    t[i] = a[i] - b[i];
+                break;
+            case multiplication:
+                for(std::size_t i = 0; i < n; i++)
+                    t[i] = a[i] * b[i];
+                break;
+            case division:
+                for(std::size_t i = 0; i < n; i++)
+                    t[i] = a[i] / b[i];
+                break;
+            case negation:
+                for(std::size_t i = 0; i < n; i++)
+                    t[i] = -a[i];
+                break;
+            case power:
+                if(instruction.right == 2)
+                    for(std::size_t i = 0; i < n; i++)
+                        t[i] = a[i] * a[i];
+                else if(instruction.right == -1)
+                    for(std::size_t i = 0; i < n; i++)
+                        t[i] = 1. / a[i];
+                else
+                    for(std::size_t i = 0; i < n; i++)
+                        t[i] = std::pow(a[i], instruction.right);
+                break;
+            case root:
+                if(instruction.right == 2)
+                    for(std::size_t i = 0; i < n; i++)
+                        t[i] = std::sqrt(a[i]);
+                else
+                    for(std::size_t i = 0; i < n; i++)
+                        t[i] = std::pow(a[i], 1. / instruction.right);
+                break;
+            }
+        }
+
+        std::copy_n(operands[result], n, results + start);
+    }
+}
+
+PhysicalVariable CompiledFormula::operator()(const double* values) const
+{
+    std::vector<const double*> columns(inputs.size());
+    for(std::size_t v = 0; v < inputs.size(); v++)
+        columns[v] = values + v;
+    double value;
+    evaluate(1, &value, columns.data());
+    return PhysicalVariable(value, unit);
+}
@@ -0,0 +1,86 @@
+#ifndef C11EXPRESSION_H_INCLUDED
+#define C11EXPRESSION_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "C11Units.h"
+
+/// A variable of a CompiledFormula and the unit its values are given in, as
+/// a symbol of C11UNITS_LITERALS ("kN", "mus", "kohm", ...). An empty unit
+/// means dimensionless.
+struct FormulaVariable
+{
+    std::string name;
+    std::string unit;
+};
+
+/// Compiles formula text such as "F * (d1 + d2) / t / A^2" once and then
+/// evaluates it over columns of plain doubles. Units are checked while
+/// compiling, so a bad formula throws unitErrorException (or UnitParseError
+/// for bad syntax) from the constructor. Evaluation runs a small register
+/// machine on blocks of blockSize rows, so decoding an instruction is paid
+/// once per block instead of once per row.
+///
+/// Besides variables the text may contain + - * /, integral powers (x^2,
+/// x^-1), sqrt(x), root(x, n), parentheses, plain numbers and numbers with a
+/// literal suffix like 9.81_m or 1.5_kohm.
+///
+/// x^n raises the value as well as the unit, like PhysicalVariable::pow().
+/// PhysicalVariable::operator^ only changes the unit, so "A^2" here and
+/// (0.5_m^2) in C++ differ by the factor A.
+class CompiledFormula
+{
+public:
+    static const std::size_t blockSize = 256;
+
+    CompiledFormula(const std::string& text, const std::vector<FormulaVariable>& variables);
+
+    /// Results are in SI units of getUnit().
+    Unit getUnit() const;
+    std::size_t variableCount() const;
+
+    /// columns[i] points to count values of the i-th variable.
+    void evaluate(std::size_t count, double* results, const double* const* columns) const;
+
+    /// Evaluates a single row, values holds one value per variable.
+    PhysicalVariable operator()(const double* values) const;
+
+private:
+    class Compiler;
+
+    enum Opcode : unsigned char { addition, subtraction, multiplication, division, negation, power, root };
+
+    /// Operands are register numbers; power and root keep their exponent in
+    /// right instead.
+    struct Instruction
+    {
+        Opcode opcode;
+        std::uint16_t target;
+        std::uint16_t left;
+        std::int32_t right;
+    };
+
+    /// Variable i is loaded into register i as scale * x + offset.
+    struct Input
+    {
+        double scale;
+        double offset;
+    };
+
+    struct Constant
+    {
+        std::uint16_t target;
+        double value;
+    };
+
+    std::vector<Instruction> program;
+    std::vector<Input> inputs;
+    std::vector<Constant> constants;
+    std::size_t registerCount;
+    std::uint16_t result;
+    Unit unit;
+};
+
+#endif // C11EXPRESSION_H_INCLUDED
@@ -0,0 +1,167 @@
+#ifndef C11FORMAT_H_INCLUDED
+#define C11FORMAT_H_INCLUDED
+
+#include <algorithm>
+#include "C11Units.h"
+
+/// Formatters for std::format (C++20) and the fmt library, both writing
+/// through formatTo without allocating. The fmt formatters are defined if
+/// <fmt/format.h> is included before this header.
+///
+/// The format spec of a PhysicalVariable is [.precision][g|f|e][p], where p
+/// picks an SI prefix as QuantityFormat::prefix does:
+///
+///     std::format("{:.2f}", 9.81_m / (1._s * 1._s))  // "9.81 m / s^2"
+///     std::format("{:p}", 299792458._m / 1._s)        // "299.792 Mm / s"
+///
+/// A Unit takes no spec and prints as operator<< without the trailing space.
+
+#if __cplusplus >= 201402L
+#define C11FORMAT_CONSTEXPR constexpr
+#else
+#define C11FORMAT_CONSTEXPR
+#endif
+
+/// Large enough for any unit and a fixed notation double with a precision
+/// of up to 100 digits.
+const std::size_t quantityFormatBuffer = 512;
+
+/// Reads [.precision][g|f|e][p] up to the closing brace and throws Error for
+/// anything else.
+template<typename Error, typename Iterator>
+C11FORMAT_CONSTEXPR Iterator parseQuantityFormat(Iterator it, Iterator end, QuantityFormat& format)
+{
+    if(it != end && *it == '.')
+    {
+        int precision = 0;
+        bool digits = false;
+        for(++it; it != end && *it >= '0' && *it <= '9'; ++it, digits = true)
+            precision = precision < 1000 ? precision * 10 + (*it - '0') : precision;
+        if(!digits)
+            throw Error("Missing precision in quantity format");
+        format.precision = precision;
+    }
+    if(it != end && (*it == 'g' || *it == 'f' || *it == 'e'))
+    {
+        format.notation = *it == 'f' ? QuantityFormat::fixed : *it == 'e' ? QuantityFormat::scientific : QuantityFormat::general;
+        ++it;
+    }
+    if(it != end && *it == 'p')
+    {
+        format.prefix = true;
+        ++it;
+    }
+    if(it != end && *it != '}')
+        throw Error("Invalid quantity format");
+    return it;
+}
+
+template<typename Error, typename Iterator>
+C11FORMAT_CONSTEXPR Iterator parseUnitFormat(Iterator it, Iterator end)
+{
+    if(it != end && *it != '}')
+        throw Error("A unit takes no format spec");
+    return it;
+}
+
+template<typename Error, typename Output>
+Output copyQuantity(const PhysicalVariable& pv, QuantityFormat format, Output out)
+{
+    char buffer[quantityFormatBuffer];
+    const char* end = formatTo(buffer, buffer + sizeof(buffer), pv, format);
+    if(!end)
+        throw Error("Quantity too long for its format buffer");
+    return std::copy(static_cast<const char*>(buffer), end, out);
+}
+
+template<typename Error, typename Output>
+Output copyUnit(Unit unit, Output out)
+{
+    char buffer[quantityFormatBuffer];
+    const char* end = formatTo(buffer, buffer + sizeof(buffer), unit);
+    if(!end)
+        throw Error("Unit too long for its format buffer");
+    return std::copy(static_cast<const char*>(buffer), end, out);
+}
+
+#if defined(__has_include) && __cplusplus >= 202002L
+#if __has_include(<format>)
+#include <format>
+#endif
+#endif
+
+#if defined(__cpp_lib_format)
+namespace std
+{
+template<>
+struct formatter<PhysicalVariable, char>
+{
+    QuantityFormat spec;
+
+    constexpr auto parse(std::format_parse_context& context)
+    {
+        return parseQuantityFormat<std::format_error>(context.begin(), context.end(), spec);
+    }
+
+    template<typename FormatContext>
+    auto format(const PhysicalVariable& pv, FormatContext& context) const
+    {
+        return copyQuantity<std::format_error>(pv, spec, context.out());
+    }
+};
+
+template<>
+struct formatter<Unit, char>
+{
+    constexpr auto parse(std::format_parse_context& context)
+    {
+        return parseUnitFormat<std::format_error>(context.begin(), context.end());
+    }
+
+    template<typename FormatContext>
+    auto format(Unit unit, FormatContext& context) const
+    {
+        return copyUnit<std::format_error>(unit, context.out());
+    }
+};
+}
+#endif
+
+#if defined(FMT_VERSION)
+namespace fmt
+{
+template<>
+struct formatter<PhysicalVariable>
+{
+    QuantityFormat spec;
+
+    C11FORMAT_CONSTEXPR auto parse(fmt::format_parse_context& context) -> decltype(context.begin())
+    {
+        return parseQuantityFormat<fmt::format_error>(context.begin(), context.end(), spec);
+    }
+
+    template<typename FormatContext>
+    auto format(const PhysicalVariable& pv, FormatContext& context) const -> decltype(context.out())
+    {
+        return copyQuantity<fmt::format_error>(pv, spec, context.out());
+    }
+};
+
+template<>
+struct formatter<Unit>
+{
+    C11FORMAT_CONSTEXPR auto parse(fmt::format_parse_context& context) -> decltype(context.begin())
+    {
+        return parseUnitFormat<fmt::format_error>(context.begin(), context.end());
+    }
+
+    template<typename FormatContext>
+    auto format(Unit unit, FormatContext& context) const -> decltype(context.out())
+    {
+        return copyUnit<fmt::format_error>(unit, context.out());
+    }
+};
+}
+#endif
+
+#endif // C11FORMAT_H_INCLUDED
@@ -0,0 +1,184 @@
+#ifndef C11FORMULA_H_INCLUDED
+#define C11FORMULA_H_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "C11Units.h"
+
+/// A Formula checks the units of a calculation once, when it is built from
+/// placeholder arguments, and afterwards takes and returns plain doubles.
+///
+///     auto field = makeFormula([](PhysicalVariable I, PhysicalVariable l) { return I * mu_0 / l; }, 1_A, 1_m);
+///     field.getUnit();                  /// T
+///     double b = field.evaluate(10., 0.12);
+///
+/// Dimension errors are thrown by makeFormula, whatever the UnitErrorPolicy
+/// mode is; since every evaluation sees the same units, none can happen
+/// later. Arguments and results of evaluate are values in the units of the
+/// placeholders and of getUnit().
+///
+/// A callable taking PhysicalVariables still does its unit arithmetic on
+/// every call, as it cannot run without units; that is a few integer
+/// operations per step, and nothing in C11UNITS_UNCHECKED builds. Only a
+/// callable that also accepts doubles, such as a generic lambda in C++14,
+/// can skip the unit work, and it has to be built with the formulaOnDoubles
+/// tag:
+///
+///     auto area = makeFormula(formulaOnDoubles, [](auto w, auto h) { return w * h; }, 1_m, 1_m);
+///
+/// Then evaluate calls it with plain doubles. The tag is a promise that the
+/// callable computes the same values for doubles as for PhysicalVariables;
+/// operator^, which only changes the unit, breaks it. It is not the default
+/// because a generic lambda whose body does not compile for doubles would
+/// be a hard error that no trait can detect beforehand.
+
+template<std::size_t... I>
+struct FormulaIndices {};
+
+template<std::size_t N, std::size_t... I>
+struct MakeFormulaIndices : MakeFormulaIndices<N - 1, N - 1, I...> {};
+
+template<std::size_t... I>
+struct MakeFormulaIndices<0, I...>
+{
+    typedef FormulaIndices<I...> type;
+};
+
+/// Selects the overload of makeFormula that evaluates on doubles.
+struct FormulaOnDoubles {};
+
+const FormulaOnDoubles formulaOnDoubles = {};
+
+template<typename F, std::size_t N, bool OnDoubles = false>
+class Formula
+{
+public:
+    template<typename... Placeholders>
+    explicit Formula(F f, const Placeholders... placeholders)
+        : function(f), argumentUnits{{PhysicalVariable(placeholders).getUnit()...}}, unit(infer(f, placeholders...))
+    {
+        static_assert(sizeof...(Placeholders) == N, "A Formula needs one placeholder per argument");
+    }
+
+    Unit getUnit() const
+    {
+        return unit;
+    }
+
+    Unit getArgumentUnit(std::size_t i) const
+    {
+        return argumentUnits[i];
+    }
+
+    template<typename... Args>
+    double evaluate(const Args... args) const
+    {
+        static_assert(sizeof...(Args) == N, "Wrong number of arguments for this Formula");
+        return call(std::integral_constant<bool, OnDoubles>(), typename MakeFormulaIndices<N>::type(),
+                    static_cast<double>(args)...);
+    }
+
+    /// Evaluates count rows at once; the i-th argument of row r is columns[i][r].
+    template<typename... Columns>
+    void evaluateBatch(std::size_t count, double* results, const Columns*... columns) const
+    {
+        static_assert(sizeof...(Columns) == N, "Wrong number of columns for this Formula");
+        evaluateRows(std::integral_constant<bool, OnDoubles>(), typename MakeFormulaIndices<N>::type(), count, results,
+                     columns...);
+    }
+
+    /// Evaluates with units; the result carries getUnit().
+    template<typename... Args>
+    PhysicalVariable operator()(const Args... args) const
+    {
+        return PhysicalVariable(evaluate(args...), unit);
+    }
+
+private:
+    /// Temporarily switches to exceptions, so a bad formula cannot hide
+    /// behind a NaN.
+    class ThrowingScope
+    {
+    public:
+        ThrowingScope() : previous(UnitErrorPolicy::mode()) { UnitErrorPolicy::setMode(UnitErrorPolicy::throwException); }
+        ~ThrowingScope() { UnitErrorPolicy::setMode(previous); }
+
+    private:
+        UnitErrorPolicy::Mode previous;
+    };
+
+    static Unit unitOf(const PhysicalVariable v)
+    {
+        return v.getUnit();
+    }
+
+    static Unit unitOf(const double)
+    {
+        return Unit({});
+    }
+
+    static double valueOf(const PhysicalVariable v)
+    {
+        return v.getValue();
+    }
+
+    static double valueOf(const double v)
+    {
+        return v;
+    }
+
+    template<typename... Placeholders>
+    static Unit infer(const F& f, const Placeholders... placeholders)
+    {
+        ThrowingScope scope;
+        return unitOf(f(PhysicalVariable(placeholders)...));
+    }
+
+    template<std::size_t... I, typename... Args>
+    double call(std::true_type, FormulaIndices<I...>, const Args... args) const
+    {
+        return valueOf(function(args...));
+    }
+
+    template<std::size_t... I, typename... Args>
+    double call(std::false_type, FormulaIndices<I...>, const Args... args) const
+    {
+        return valueOf(function(PhysicalVariable(args, argumentUnits[I])...));
+    }
+
+    template<std::size_t... I, typename... Columns>
+    void evaluateRows(std::true_type, FormulaIndices<I...>, std::size_t count, double* results, const Columns*... columns) const
+    {
+        for(std::size_t r = 0; r < count; r++)
+            results[r] = valueOf(function(static_cast<double>(columns[r])...));
+    }
+
+    /// The units are loaded once, so each row only pairs them with its values.
+    template<std::size_t... I, typename... Columns>
+    void evaluateRows(std::false_type, FormulaIndices<I...>, std::size_t count, double* results, const Columns*... columns) const
+    {
+        const std::array<Unit, N> units = argumentUnits;
+        for(std::size_t r = 0; r < count; r++)
+            results[r] = valueOf(function(PhysicalVariable(static_cast<double>(columns[r]), units[I])...));
+    }
+
+    F function;
+    std::array<Unit, N> argumentUnits;
+    Unit unit;
+};
+
+template<typename F, typename... Placeholders>
+Formula<F, sizeof...(Placeholders)> makeFormula(F f, const Placeholders... placeholders)
+{
+    return Formula<F, sizeof...(Placeholders)>(f, placeholders...);
+}
+
+template<typename F, typename... Placeholders>
+Formula<F, sizeof...(Placeholders), true> makeFormula(FormulaOnDoubles, F f, const Placeholders... placeholders)
+{
+    return Formula<F, sizeof...(Placeholders), true>(f, placeholders...);
+}
+
+#endif // C11FORMULA_H_INCLUDED
@@ -0,0 +1,245 @@
+#include "C11Kernels.h"
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define C11KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    typedef void (*BinaryKernel)(std::size_t, const double*, const double*, double*);
+    typedef void (*ScalarKernel)(std::size_t, const double*, double, double*);
+    typedef void (*PowerKernel)(std::size_t, const double*, unsigned, bool, double*);
+    typedef void (*UnaryKernel)(std::size_t, const double*, double*);
+
+    struct KernelTable
+    {
+        QuantityKernels::InstructionSet instructionSet;
+        BinaryKernel add;
+        BinaryKernel subtract;
+        BinaryKernel multiply;
+        BinaryKernel divide;
+        ScalarKernel addScalar;
+        ScalarKernel scale;
+        PowerKernel power;
+        UnaryKernel sqrt;
+    };
+
+    /// Same order of multiplications as the vector kernels, so every element
+    /// gets the same result wherever it sits in the buffer.
+    inline double smallPower(double x, unsigned exponent, bool invert)
+    {
+        double y = exponent == 1 ? x : exponent == 2 ? x * x : exponent == 3 ? x * x * x : (x * x) * (x * x);
+        return invert ? 1. / y : y;
+    }
+}
+
+/// Defines the kernels of one instruction set. VECTOR holds WIDTH doubles,
+/// the remaining arguments name its intrinsics.
+#define C11KERNELS_DEFINE(NAME, TARGET, VECTOR, WIDTH, LOAD, STORE, BROADCAST, ADD, SUB, MUL, DIV, SQRT) \
+    namespace \
+    { \
+        TARGET void NAME##Add(std::size_t n, const double* a, const double* b, double* r) \
+        { \
+            std::size_t i = 0; \
+            for(; i + WIDTH <= n; i += WIDTH) \
+                STORE(r + i, ADD(LOAD(a + i), LOAD(b + i))); \
+            for(; i < n; i++) \
+                r[i] = a[i] + b[i]; \
+        } \
+        TARGET void NAME##Subtract(std::size_t n, const double* a, const double* b, double* r) \
+        { \
+            std::size_t i = 0; \
+            for(; i + WIDTH <= n; i += WIDTH) \
+                STORE(r + i, SUB(LOAD(a + i), LOAD(b + i))); \
+            for(; i < n; i++) \
+                r[i] = a[i] - b[i]; \
+        } \
+        TARGET void NAME##Multiply(std::size_t n, const double* a, const double* b, double* r) \
+        { \
+            std::size_t i = 0; \
+            for(; i + WIDTH <= n; i += WIDTH) \
+                STORE(r + i, MUL(LOAD(a + i), LOAD(b + i))); \
+            for(; i < n; i++) \
+                r[i] = a[i] * b[i]; \
+        } \
+        TARGET void NAME##Divide(std::size_t n, const double* a, const double* b, double* r) \
+        { \
+            std::size_t i = 0; \
+            for(; i + WIDTH <= n; i += WIDTH) \
+                STORE(r + i, DIV(LOAD(a + i), LOAD(b + i))); \
+            for(; i < n; i++) \
+                r[i] = a[i] / b[i]; \
+        } \
+        TARGET void NAME##AddScalar(std::size_t n, const double* a, double b, double* r) \
+        { \
+            const VECTOR v = BROADCAST(b); \
+            std::size_t i = 0; \
+            for(; i + WIDTH <= n; i += WIDTH) \
+                STORE(r + i, ADD(LOAD(a + i), v)); \
+            for(; i < n; i++) \
+                r[i] = a[i] + b; \
+        } \
+        TARGET void NAME##Scale(std::size_t n, const double* a, double factor, double* r) \
+        { \
+            const VECTOR v = BROADCAST(factor); \
+            std::size_t i = 0; \
+            for(; i + WIDTH <= n; i += WIDTH) \
+                STORE(r + i, MUL(LOAD(a + i), v)); \
+            for(; i < n; i++) \
+                r[i] = a[i] * factor; \
+        } \
+        TARGET void NAME##Power(std::size_t n, const double* a, unsigned exponent, bool invert, double* r) \
+        { \
+            const VECTOR one = BROADCAST(1.); \
+            std::size_t i = 0; \
+            for(; i + WIDTH <= n; i += WIDTH) \
+            { \
+                VECTOR x = LOAD(a + i); \
+                VECTOR y = exponent == 1 ? x : exponent == 2 ? MUL(x, x) : \
+                           exponent == 3 ? MUL(MUL(x, x), x) : MUL(MUL(x, x), MUL(x, x)); \
+                STORE(r + i, invert ? DIV(one, y) : y); \
+            } \
+            for(; i < n; i++) \
+                r[i] = smallPower(a[i], exponent, invert); \
+        } \
+        TARGET void NAME##Sqrt(std::size_t n, const double* a, double* r) \
+        { \
+            std::size_t i = 0; \
+            for(; i + WIDTH <= n; i += WIDTH) \
+                STORE(r + i, SQRT(LOAD(a + i))); \
+            for(; i < n; i++) \
+                r[i] = std::sqrt(a[i]); \
+        } \
+        const KernelTable NAME##Kernels = {QuantityKernels::NAME, NAME##Add, NAME##Subtract, NAME##Multiply, NAME##Divide, \
+                                           NAME##AddScalar, NAME##Scale, NAME##Power, NAME##Sqrt}; \
+    }
+
+namespace
+{
+    inline double scalarLoad(const double* p) { return *p; }
+    inline void scalarStore(double* p, double v) { *p = v; }
+    inline double scalarBroadcast(double v) { return v; }
+    inline double scalarAdd(double a, double b) { return a + b; }
+    inline double scalarSub(double a, double b) { return a - b; }
+    inline double scalarMul(double a, double b) { return a * b; }
+    inline double scalarDiv(double a, double b) { return a / b; }
+    inline double scalarSqrt(double a) { return std::sqrt(a); }
+}
+
+C11KERNELS_DEFINE(scalar, , double, 1, scalarLoad, scalarStore, scalarBroadcast,
+                  scalarAdd, scalarSub, scalarMul, scalarDiv, scalarSqrt)
+
+#ifdef C11KERNELS_X86
+namespace
+{
+    /// The masked form does not trip -Wmaybe-uninitialized in GCC's headers.
+    __attribute__((target("avx512f"))) inline __m512d avx512SqrtPd(__m512d x)
+    {
+        return _mm512_maskz_sqrt_pd(0xFF, x);
+    }
+}
+
+C11KERNELS_DEFINE(sse2, __attribute__((target("sse2"))), __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd,
+                  _mm_add_pd, _mm_sub_pd, _mm_mul_pd, _mm_div_pd, _mm_sqrt_pd)
+C11KERNELS_DEFINE(avx2, __attribute__((target("avx2"))), __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd,
+                  _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd, _mm256_div_pd, _mm256_sqrt_pd)
+C11KERNELS_DEFINE(avx512, __attribute__((target("avx512f"))), __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd,
+                  _mm512_add_pd, _mm512_sub_pd, _mm512_mul_pd, _mm512_div_pd, avx512SqrtPd)
+#endif
+
+#undef C11KERNELS_DEFINE
+
+namespace
+{
+    const KernelTable& selectKernels()
+    {
+#ifdef C11KERNELS_X86
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f"))
+            return avx512Kernels;
+        if(__builtin_cpu_supports("avx2"))
+            return avx2Kernels;
+        if(__builtin_cpu_supports("sse2"))
+            return sse2Kernels;
+#endif
+        return scalarKernels;
+    }
+
+    const KernelTable& kernels()
+    {
+        static const KernelTable& table = selectKernels();
+        return table;
+    }
+}
+
+QuantityKernels::InstructionSet QuantityKernels::instructionSet()
+{
+    return kernels().instructionSet;
+}
+
+void QuantityKernels::add(std::size_t n, const double* a, const double* b, double* result)
+{
+    kernels().add(n, a, b, result);
+}
+
+void QuantityKernels::subtract(std::size_t n, const double* a, const double* b, double* result)
+{
+    kernels().subtract(n, a, b, result);
+}
+
+void QuantityKernels::multiply(std::size_t n, const double* a, const double* b, double* result)
+{
+    kernels().multiply(n, a, b, result);
+}
+
+void QuantityKernels::divide(std::size_t n, const double* a, const double* b, double* result)
+{
+    kernels().divide(n, a, b, result);
+}
+
+void QuantityKernels::addScalar(std::size_t n, const double* a, double b, double* result)
+{
+    kernels().addScalar(n, a, b, result);
+}
+
+void QuantityKernels::scale(std::size_t n, const double* a, double factor, double* result)
+{
+    kernels().scale(n, a, factor, result);
+}
+
+void QuantityKernels::pow(std::size_t n, const double* a, signed exponent, double* result)
+{
+    const unsigned magnitude = std::abs(exponent);
+    if(exponent == 0)
+    {
+        for(std::size_t i = 0; i < n; i++)
+            result[i] = 1.;
+    }
+    else if(magnitude <= 4)
+        kernels().power(n, a, magnitude, exponent < 0, result);
+    else
+    {
+        for(std::size_t i = 0; i < n; i++)
+            result[i] = std::pow(a[i], exponent);
+    }
+}
+
+void QuantityKernels::root(std::size_t n, const double* a, signed exponent, double* result)
+{
+    if(exponent == 2)
+        kernels().sqrt(n, a, result);
+    else if(exponent == 3)
+    {
+        for(std::size_t i = 0; i < n; i++)
+            result[i] = a[i] < 0. ? std::numeric_limits<double>::quiet_NaN() : std::cbrt(a[i]);
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; i++)
+            result[i] = std::pow(a[i], 1. / exponent);
+    }
+}
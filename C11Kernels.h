@@ -0,0 +1,32 @@
+#ifndef C11KERNELS_H_INCLUDED
+#define C11KERNELS_H_INCLUDED
+
+#include <cstddef>
+
+/// Vectorized loops over buffers of doubles that share one unit, so they
+/// know nothing about units. The instruction set (SSE2, AVX2 or AVX-512 on
+/// x86, plain C++ elsewhere) is picked once at runtime. result may be the
+/// same buffer as an operand; no alignment is required, aligned buffers are
+/// just faster.
+class QuantityKernels
+{
+public:
+    enum InstructionSet { scalar, sse2, avx2, avx512 };
+
+    static InstructionSet instructionSet();
+
+    static void add(std::size_t n, const double* a, const double* b, double* result);
+    static void subtract(std::size_t n, const double* a, const double* b, double* result);
+    static void multiply(std::size_t n, const double* a, const double* b, double* result);
+    static void divide(std::size_t n, const double* a, const double* b, double* result);
+    static void addScalar(std::size_t n, const double* a, double b, double* result);
+    static void scale(std::size_t n, const double* a, double factor, double* result);
+    /// Exponents up to 4 in magnitude are computed by multiplication, larger
+    /// ones by std::pow.
+    static void pow(std::size_t n, const double* a, signed exponent, double* result);
+    /// Square roots are vectorized, cube roots use std::cbrt; both give NaN
+    /// for negative values just like std::pow(x, 1./exponent).
+    static void root(std::size_t n, const double* a, signed exponent, double* result);
+};
+
+#endif // C11KERNELS_H_INCLUDED
@@ -0,0 +1,332 @@
+#include "C11Parallel.h"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#if defined(C11UNITS_STD_EXECUTION) && __cplusplus >= 201703L
+#include <execution>
+#include <numeric>
+#define C11PARALLEL_STD_EXECUTION 1
+#endif
+
+namespace
+{
+    /// Set while a thread works on a job, so nested jobs do not wait for
+    /// workers that are busy with the outer one.
+    thread_local bool insideJob = false;
+
+    /// Runs part of a job under the UnitErrorPolicy mode of the thread that
+    /// started it, with a clean status, and puts the thread's own mode and
+    /// status back when done.
+    class BorrowedErrorPolicy
+    {
+    public:
+        explicit BorrowedErrorPolicy(UnitErrorPolicy::Mode mode)
+            : ownMode(UnitErrorPolicy::mode()), ownStatus(UnitErrorPolicy::status()), ownOperation(UnitErrorPolicy::operation())
+        {
+            UnitErrorPolicy::setMode(mode);
+            UnitErrorPolicy::clear();
+        }
+
+        /// Restoring must not throw, so the own status is reported while
+        /// poisoning.
+        ~BorrowedErrorPolicy()
+        {
+            UnitErrorPolicy::setMode(UnitErrorPolicy::poisonWithNaN);
+            UnitErrorPolicy::clear();
+            if(ownStatus != unitOk)
+                UnitErrorPolicy::report(ownStatus, ownOperation);
+            UnitErrorPolicy::setMode(ownMode);
+        }
+
+        /// Keeps the first error reported under the borrowed mode in status.
+        void mergeInto(std::mutex& mutex, UnitStatus& status, const char*& operation) const
+        {
+            if(UnitErrorPolicy::status() == unitOk)
+                return;
+            std::lock_guard<std::mutex> lock(mutex);
+            if(status == unitOk)
+            {
+                status = UnitErrorPolicy::status();
+                operation = UnitErrorPolicy::operation();
+            }
+        }
+
+    private:
+        const UnitErrorPolicy::Mode ownMode;
+        const UnitStatus ownStatus;
+        const char* const ownOperation;
+    };
+}
+
+struct ThreadPool::State
+{
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::mutex serial;
+    std::vector<std::thread> workers;
+
+    const std::function<void(std::size_t)>* task = nullptr;
+    std::size_t count = 0;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> completed{0};
+    unsigned active = 0;
+    unsigned generation = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+
+    /// The caller's UnitErrorPolicy mode, and the first error a task reported
+    /// under it.
+    UnitErrorPolicy::Mode mode = UnitErrorPolicy::throwException;
+    UnitStatus status = unitOk;
+    const char* operation = "";
+
+    void drain(const std::function<void(std::size_t)>* job, std::size_t jobCount, UnitErrorPolicy::Mode jobMode)
+    {
+        insideJob = true;
+        BorrowedErrorPolicy policy(jobMode);
+        for(;;)
+        {
+            std::size_t i = next.fetch_add(1);
+            if(i >= jobCount)
+                break;
+            try
+            {
+                (*job)(i);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!error)
+                    error = std::current_exception();
+            }
+            if(completed.fetch_add(1) + 1 == jobCount)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                done.notify_all();
+            }
+        }
+        policy.mergeInto(mutex, status, operation);
+        insideJob = false;
+    }
+
+    void work()
+    {
+        unsigned seen = 0;
+        for(;;)
+        {
+            const std::function<void(std::size_t)>* job;
+            std::size_t jobCount;
+            UnitErrorPolicy::Mode jobMode;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || generation != seen; });
+                if(stopping)
+                    return;
+                seen = generation;
+                job = task;
+                jobCount = count;
+                jobMode = mode;
+                active++;
+            }
+            drain(job, jobCount, jobMode);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                active--;
+                done.notify_all();
+            }
+        }
+    }
+};
+
+ThreadPool::ThreadPool(unsigned threads) : state(new State)
+{
+    for(unsigned i = 1; i < threads; i++)
+        state->workers.emplace_back([this] { state->work(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->stopping = true;
+    }
+    state->wake.notify_all();
+    for(std::thread& worker : state->workers)
+        worker.join();
+    delete state;
+}
+
+ThreadPool& ThreadPool::global()
+{
+    static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+    return pool;
+}
+
+unsigned ThreadPool::size() const
+{
+    return state->workers.size() + 1;
+}
+
+void ThreadPool::run(std::size_t count, const std::function<void(std::size_t)>& task)
+{
+    if(count == 0)
+        return;
+    if(state->workers.empty() || count == 1 || insideJob)
+    {
+        for(std::size_t i = 0; i < count; i++)
+            task(i);
+        return;
+    }
+
+    std::lock_guard<std::mutex> serial(state->serial);
+    {
+        /// Workers that woke up late for the previous job must be gone
+        /// before its counters are reset.
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [this] { return state->active == 0; });
+        state->task = &task;
+        state->count = count;
+        state->next = 0;
+        state->completed = 0;
+        state->error = nullptr;
+        state->mode = UnitErrorPolicy::mode();
+        state->status = unitOk;
+        state->operation = "";
+        state->generation++;
+    }
+    state->wake.notify_all();
+    state->drain(&task, count, UnitErrorPolicy::mode());
+
+    std::exception_ptr error;
+    UnitStatus status;
+    const char* operation;
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [this, count] { return state->completed == count && state->active == 0; });
+        error = state->error;
+        status = state->status;
+        operation = state->operation;
+    }
+    if(error)
+        std::rethrow_exception(error);
+    /// Only reached while poisoning, the caller's first error stays sticky.
+    if(status != unitOk)
+        UnitErrorPolicy::report(status, operation);
+}
+
+void parallelChunks(std::size_t count, const std::function<void(std::size_t, std::size_t)>& task)
+{
+    const std::size_t chunks = (count + parallelChunkSize - 1) / parallelChunkSize;
+    auto chunk = [&](std::size_t i) { task(i * parallelChunkSize, std::min(count, (i + 1) * parallelChunkSize)); };
+#ifdef C11PARALLEL_STD_EXECUTION
+    std::vector<std::size_t> indices(chunks);
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+    const UnitErrorPolicy::Mode mode = UnitErrorPolicy::mode();
+    std::mutex mutex;
+    UnitStatus status = unitOk;
+    const char* operation = "";
+    std::for_each(std::execution::par, indices.begin(), indices.end(), [&](std::size_t i)
+    {
+        BorrowedErrorPolicy policy(mode);
+        chunk(i);
+        policy.mergeInto(mutex, status, operation);
+    });
+    if(status != unitOk)
+        UnitErrorPolicy::report(status, operation);
+#else
+    ThreadPool::global().run(chunks, chunk);
+#endif
+}
+
+namespace
+{
+    /// Sums chunk by chunk with a fixed chunk size, so the rounding does not
+    /// depend on the number of threads.
+    template<typename F>
+    double sumChunks(std::size_t count, F partialSum)
+    {
+        std::vector<double> partial((count + parallelChunkSize - 1) / parallelChunkSize);
+        parallelChunks(count, [&](std::size_t begin, std::size_t end)
+        {
+            partial[begin / parallelChunkSize] = partialSum(begin, end);
+        });
+        double sum = 0.;
+        for(double p : partial)
+            sum += p;
+        return sum;
+    }
+}
+
+PhysicalVariable parallelSum(const QuantityView& a)
+{
+    const double* x = a.data();
+    return PhysicalVariable(sumChunks(a.size(), [x](std::size_t begin, std::size_t end)
+    {
+        double sum = 0.;
+        for(std::size_t i = begin; i < end; i++)
+            sum += x[i];
+        return sum;
+    }), a.getUnit());
+}
+
+PhysicalVariable parallelMean(const QuantityView& a)
+{
+    return parallelSum(a) / static_cast<double>(a.size());
+}
+
+PhysicalVariable parallelDot(const QuantityView& a, const QuantityView& b)
+{
+    if(a.size() != b.size())
+        throw std::length_error("QuantityArrays of different sizes");
+    if(!a.getUnit().canMultiply(b.getUnit()))
+    {
+        UnitErrorPolicy::report(unitExponentOverflow, "dot");
+        return PhysicalVariable(std::numeric_limits<double>::quiet_NaN(), Unit({}));
+    }
+    const double* x = a.data();
+    const double* y = b.data();
+    return PhysicalVariable(sumChunks(a.size(), [x, y](std::size_t begin, std::size_t end)
+    {
+        double sum = 0.;
+        for(std::size_t i = begin; i < end; i++)
+            sum += x[i] * y[i];
+        return sum;
+    }), a.getUnit() * b.getUnit());
+}
+
+namespace
+{
+    template<typename Less>
+    PhysicalVariable extremum(const QuantityView& a, double identity, Less less)
+    {
+        const double* x = a.data();
+        std::vector<double> partial((a.size() + parallelChunkSize - 1) / parallelChunkSize, identity);
+        parallelChunks(a.size(), [&](std::size_t begin, std::size_t end)
+        {
+            double m = identity;
+            for(std::size_t i = begin; i < end; i++)
+                m = less(x[i], m) ? x[i] : m;
+            partial[begin / parallelChunkSize] = m;
+        });
+        double m = identity;
+        for(double p : partial)
+            m = less(p, m) ? p : m;
+        return PhysicalVariable(m, a.getUnit());
+    }
+}
+
+PhysicalVariable parallelMin(const QuantityView& a)
+{
+    return extremum(a, std::numeric_limits<double>::infinity(), [](double x, double y) { return x < y; });
+}
+
+PhysicalVariable parallelMax(const QuantityView& a)
+{
+    return extremum(a, -std::numeric_limits<double>::infinity(), [](double x, double y) { return x > y; });
+}
@@ -0,0 +1,100 @@
+#ifndef C11PARALLEL_H_INCLUDED
+#define C11PARALLEL_H_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "C11QuantityArray.h"
+
+/// A fixed set of worker threads. run() hands out the indices of one job to
+/// the workers and the calling thread and returns when all are done; the
+/// first exception thrown by a task is rethrown there. Tasks run under the
+/// UnitErrorPolicy mode of the calling thread; while poisoning, the first
+/// error a task reported is reported on the calling thread. Jobs started from
+/// inside a task run serially on the current thread.
+class ThreadPool
+{
+public:
+    /// threads counts the calling thread, so 1 means no workers.
+    explicit ThreadPool(unsigned threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Uses every core.
+    static ThreadPool& global();
+
+    unsigned size() const;
+    void run(std::size_t count, const std::function<void(std::size_t)>& task);
+
+private:
+    struct State;
+    State* state;
+};
+
+/// Calls task(begin, end) for consecutive chunks of [0, count). The chunks
+/// do not depend on the number of threads, so results combined per chunk
+/// are reproducible. Runs on ThreadPool::global(), or on std::execution::par
+/// when compiled as C++17 with C11UNITS_STD_EXECUTION.
+void parallelChunks(std::size_t count, const std::function<void(std::size_t, std::size_t)>& task);
+
+const std::size_t parallelChunkSize = 1 << 15;
+
+/// Reductions over QuantityArrays and QuantityViews, such as table columns.
+/// Sums keep the unit, dot multiplies the units. min and max of an empty
+/// array are +/- infinity.
+PhysicalVariable parallelSum(const QuantityView& a);
+PhysicalVariable parallelMean(const QuantityView& a);
+PhysicalVariable parallelDot(const QuantityView& a, const QuantityView& b);
+PhysicalVariable parallelMin(const QuantityView& a);
+PhysicalVariable parallelMax(const QuantityView& a);
+
+/// op has to be associative; every chunk is folded on its own, then the
+/// chunk results are folded into init in order.
+template<typename Op, typename Transform>
+PhysicalVariable parallelTransformReduce(const QuantityView& a, const PhysicalVariable init, Op op, Transform transform)
+{
+    const std::size_t chunks = (a.size() + parallelChunkSize - 1) / parallelChunkSize;
+    std::vector<PhysicalVariable> partial(chunks, init);
+    parallelChunks(a.size(), [&](std::size_t begin, std::size_t end)
+    {
+        PhysicalVariable result = transform(a[begin]);
+        for(std::size_t i = begin + 1; i < end; i++)
+            result = op(result, transform(a[i]));
+        partial[begin / parallelChunkSize] = result;
+    });
+    PhysicalVariable result = init;
+    for(const PhysicalVariable& p : partial)
+        result = op(result, p);
+    return result;
+}
+
+template<typename Op>
+PhysicalVariable parallelReduce(const QuantityView& a, const PhysicalVariable init, Op op)
+{
+    return parallelTransformReduce(a, init, op, [](const PhysicalVariable v) { return v; });
+}
+
+/// Applies f to every element. The unit of the result is taken from the
+/// first call, which runs on the calling thread; afterwards only values
+/// are kept.
+template<typename F>
+QuantityArray parallelTransform(const QuantityView& a, F f)
+{
+    if(a.empty())
+        return QuantityArray(f(PhysicalVariable(0., a.getUnit())).getUnit(), 0);
+    const PhysicalVariable first = f(a[0]);
+    QuantityArray result(first.getUnit(), a.size());
+    double* r = result.data();
+    r[0] = first.getValue();
+    parallelChunks(a.size(), [&](std::size_t begin, std::size_t end)
+    {
+        for(std::size_t i = std::max<std::size_t>(begin, 1); i < end; i++)
+            r[i] = f(a[i]).getValue();
+    });
+    return result;
+}
+
+#endif // C11PARALLEL_H_INCLUDED
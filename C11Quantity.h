@@ -0,0 +1,172 @@
+#ifndef C11QUANTITY_H_INCLUDED
+#define C11QUANTITY_H_INCLUDED
+
+#include <type_traits>
+#include "C11Units.h"
+
+/// Compile-time counterpart of PhysicalVariable.
+/// The dimension is part of the type, so unit algebra is resolved by the
+/// compiler and a Quantity<double, ...> is nothing but a double at runtime.
+/// Use PhysicalVariable when units are only known at runtime.
+
+/// Exponents of the SI base units m, kg, s, A, K, mol and Cd.
+template<signed L, signed M, signed T, signed I, signed Theta, signed N, signed J>
+struct Dimension
+{
+    static constexpr signed m = L;
+    static constexpr signed kg = M;
+    static constexpr signed s = T;
+    static constexpr signed A = I;
+    static constexpr signed K = Theta;
+    static constexpr signed mol = N;
+    static constexpr signed Cd = J;
+};
+
+template<typename D1, typename D2>
+struct DimensionProduct
+{
+    typedef Dimension<D1::m + D2::m, D1::kg + D2::kg, D1::s + D2::s, D1::A + D2::A,
+                      D1::K + D2::K, D1::mol + D2::mol, D1::Cd + D2::Cd> type;
+};
+
+template<typename D1, typename D2>
+struct DimensionQuotient
+{
+    typedef Dimension<D1::m - D2::m, D1::kg - D2::kg, D1::s - D2::s, D1::A - D2::A,
+                      D1::K - D2::K, D1::mol - D2::mol, D1::Cd - D2::Cd> type;
+};
+
+template<typename D, signed N>
+struct DimensionPower
+{
+    typedef Dimension<D::m * N, D::kg * N, D::s * N, D::A * N,
+                      D::K * N, D::mol * N, D::Cd * N> type;
+};
+
+template<typename D, signed N>
+struct DimensionRoot
+{
+    static_assert(N != 0, "The zeroth root is not defined");
+    static_assert(D::m % N == 0 && D::kg % N == 0 && D::s % N == 0 && D::A % N == 0 &&
+                  D::K % N == 0 && D::mol % N == 0 && D::Cd % N == 0,
+                  "You cannot generate units with non-integral exponentials!");
+    typedef Dimension<D::m / N, D::kg / N, D::s / N, D::A / N,
+                      D::K / N, D::mol / N, D::Cd / N> type;
+};
+
+typedef Dimension<0, 0, 0, 0, 0, 0, 0> Dimensionless;
+typedef Dimension<1, 0, 0, 0, 0, 0, 0> LengthDimension;
+typedef Dimension<0, 1, 0, 0, 0, 0, 0> MassDimension;
+typedef Dimension<0, 0, 1, 0, 0, 0, 0> TimeDimension;
+typedef Dimension<0, 0, 0, 1, 0, 0, 0> CurrentDimension;
+typedef Dimension<0, 0, 0, 0, 1, 0, 0> TemperatureDimension;
+typedef Dimension<0, 0, 0, 0, 0, 1, 0> AmountDimension;
+typedef Dimension<0, 0, 0, 0, 0, 0, 1> LuminousIntensityDimension;
+
+template<typename Scalar, typename Dim>
+class Quantity
+{
+public:
+    typedef Scalar scalar_type;
+    typedef Dim dimension;
+
+    constexpr Quantity() : value() {}
+    constexpr explicit Quantity(Scalar v) : value(v) {}
+
+    constexpr Scalar count() const { return value; }
+
+    constexpr Quantity operator+(const Quantity& q) const { return Quantity(value + q.value); }
+    constexpr Quantity operator-(const Quantity& q) const { return Quantity(value - q.value); }
+    constexpr Quantity operator-() const { return Quantity(-value); }
+
+    template<typename D>
+    Quantity operator+(const Quantity<Scalar, D>&) const
+    {
+        static_assert(std::is_same<Dim, D>::value, "You cannot add different types!");
+        return *this;
+    }
+
+    template<typename D>
+    Quantity operator-(const Quantity<Scalar, D>&) const
+    {
+        static_assert(std::is_same<Dim, D>::value, "You cannot subtract different types!");
+        return *this;
+    }
+
+    template<typename D>
+    constexpr Quantity<Scalar, typename DimensionProduct<Dim, D>::type> operator*(const Quantity<Scalar, D>& q) const
+    {
+        return Quantity<Scalar, typename DimensionProduct<Dim, D>::type>(value * q.count());
+    }
+
+    template<typename D>
+    constexpr Quantity<Scalar, typename DimensionQuotient<Dim, D>::type> operator/(const Quantity<Scalar, D>& q) const
+    {
+        return Quantity<Scalar, typename DimensionQuotient<Dim, D>::type>(value / q.count());
+    }
+
+    constexpr Quantity operator*(const Scalar s) const { return Quantity(value * s); }
+    constexpr Quantity operator/(const Scalar s) const { return Quantity(value / s); }
+
+    Quantity& operator+=(const Quantity& q) { value += q.value; return *this; }
+    Quantity& operator-=(const Quantity& q) { value -= q.value; return *this; }
+    Quantity& operator*=(const Scalar s) { value *= s; return *this; }
+    Quantity& operator/=(const Scalar s) { value /= s; return *this; }
+
+    constexpr bool operator==(const Quantity& q) const { return value == q.value; }
+    constexpr bool operator!=(const Quantity& q) const { return value != q.value; }
+    constexpr bool operator<(const Quantity& q) const { return value < q.value; }
+    constexpr bool operator>(const Quantity& q) const { return value > q.value; }
+    constexpr bool operator<=(const Quantity& q) const { return value <= q.value; }
+    constexpr bool operator>=(const Quantity& q) const { return value >= q.value; }
+
+    template<signed N>
+    Quantity<Scalar, typename DimensionPower<Dim, N>::type> pow() const
+    {
+        return Quantity<Scalar, typename DimensionPower<Dim, N>::type>(std::pow(value, N));
+    }
+
+    template<signed N>
+    Quantity<Scalar, typename DimensionRoot<Dim, N>::type> root() const
+    {
+        return Quantity<Scalar, typename DimensionRoot<Dim, N>::type>(std::pow(value, 1./N));
+    }
+
+    friend constexpr Quantity operator*(const Scalar s, const Quantity& q) { return q * s; }
+
+    friend constexpr Quantity<Scalar, typename DimensionQuotient<Dimensionless, Dim>::type> operator/(const Scalar s, const Quantity& q)
+    {
+        return Quantity<Scalar, Dimensionless>(s) / q;
+    }
+
+    /// Falls back to the dynamically checked representation.
+    constexpr operator PhysicalVariable() const
+    {
+        return PhysicalVariable(value, Unit(BasicUnit::A, Dim::A, BasicUnit::Cd, Dim::Cd, BasicUnit::K, Dim::K,
+                                            BasicUnit::kg, Dim::kg, BasicUnit::m, Dim::m, BasicUnit::mol, Dim::mol,
+                                            BasicUnit::s, Dim::s));
+    }
+
+private:
+    Scalar value;
+};
+
+template<typename Scalar, typename Dim>
+std::ostream& operator<< (std::ostream& out, const Quantity<Scalar, Dim>& q)
+{
+    out << static_cast<PhysicalVariable>(q);
+    return out;
+}
+
+template<typename Scalar = double> using Length = Quantity<Scalar, LengthDimension>;
+template<typename Scalar = double> using Mass = Quantity<Scalar, MassDimension>;
+template<typename Scalar = double> using Time = Quantity<Scalar, TimeDimension>;
+template<typename Scalar = double> using Current = Quantity<Scalar, CurrentDimension>;
+template<typename Scalar = double> using Temperature = Quantity<Scalar, TemperatureDimension>;
+template<typename Scalar = double> using Amount = Quantity<Scalar, AmountDimension>;
+template<typename Scalar = double> using LuminousIntensity = Quantity<Scalar, LuminousIntensityDimension>;
+
+static_assert(sizeof(Quantity<double, LengthDimension>) == sizeof(double),
+              "A Quantity must not carry anything besides its value");
+
+#endif // C11QUANTITY_H_INCLUDED
@@ -0,0 +1,323 @@
+#include "C11QuantityArray.h"
+#include "C11Kernels.h"
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+    /// Unchecked builds keep every array dimensionless, so no check can fail.
+    Unit normalized(Unit u)
+    {
+        return Unit::checked ? u : Unit({});
+    }
+}
+
+QuantityArray::Element& QuantityArray::Element::operator=(const PhysicalVariable v)
+{
+    if(!unit.compatible(v.getUnit()))
+    {
+        UnitErrorPolicy::report(unitMismatch, "=");
+        *value = std::numeric_limits<double>::quiet_NaN();
+        return *this;
+    }
+    *value = v.getValue();
+    return *this;
+}
+
+QuantityView::QuantityView(const QuantityArray& a) : values(a.data()), count(a.size()), unit(a.getUnit())
+{
+}
+
+QuantityView QuantityView::slice(std::size_t begin, std::size_t end) const
+{
+    end = end < count ? end : count;
+    begin = begin < end ? begin : end;
+    return QuantityView(values + begin, end - begin, unit);
+}
+
+QuantityArray::QuantityArray(const QuantityView& v) : values(v.data(), v.data() + v.size()), unit(v.getUnit())
+{
+}
+
+QuantityArray::QuantityArray(Unit u, std::size_t size, double value) : values(size, value), unit(normalized(u))
+{
+}
+
+QuantityArray::QuantityArray(std::vector<double> values, Unit u) : values(std::move(values)), unit(normalized(u))
+{
+}
+
+QuantityArray::QuantityArray(const std::vector<PhysicalVariable>& v)
+    : unit(v.empty() ? Unit({}) : v.front().getUnit())
+{
+    values.reserve(v.size());
+    for(const PhysicalVariable& pv : v)
+        push_back(pv);
+}
+
+std::vector<PhysicalVariable> QuantityArray::toVector() const
+{
+    std::vector<PhysicalVariable> v;
+    v.reserve(values.size());
+    for(double value : values)
+        v.push_back(PhysicalVariable(value, unit));
+    return v;
+}
+
+void QuantityArray::push_back(const PhysicalVariable v)
+{
+    if(!unit.compatible(v.getUnit()))
+    {
+        UnitErrorPolicy::report(unitMismatch, "push_back");
+        values.push_back(std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+    values.push_back(v.getValue());
+}
+
+QuantityArray& QuantityArray::poison(UnitStatus status, const char* operation)
+{
+    UnitErrorPolicy::report(status, operation);
+    values.assign(values.size(), std::numeric_limits<double>::quiet_NaN());
+    unit = Unit({});
+    return *this;
+}
+
+void QuantityArray::checkSize(const QuantityArray& a) const
+{
+    if(a.values.size() != values.size())
+        throw std::length_error("QuantityArrays of different sizes");
+}
+
+QuantityArray& QuantityArray::operator+=(const QuantityArray& a)
+{
+    checkSize(a);
+    if(!unit.compatible(a.unit))
+        return poison(unitMismatch, "+");
+    QuantityKernels::add(values.size(), values.data(), a.values.data(), values.data());
+    return *this;
+}
+
+QuantityArray& QuantityArray::operator-=(const QuantityArray& a)
+{
+    checkSize(a);
+    if(!unit.compatible(a.unit))
+        return poison(unitMismatch, "-");
+    QuantityKernels::subtract(values.size(), values.data(), a.values.data(), values.data());
+    return *this;
+}
+
+QuantityArray& QuantityArray::operator*=(const QuantityArray& a)
+{
+    checkSize(a);
+    if(!unit.canMultiply(a.unit))
+        return poison(unitExponentOverflow, "*");
+    unit *= a.unit;
+    QuantityKernels::multiply(values.size(), values.data(), a.values.data(), values.data());
+    return *this;
+}
+
+QuantityArray& QuantityArray::operator/=(const QuantityArray& a)
+{
+    checkSize(a);
+    if(!unit.canDivide(a.unit))
+        return poison(unitExponentOverflow, "/");
+    unit /= a.unit;
+    QuantityKernels::divide(values.size(), values.data(), a.values.data(), values.data());
+    return *this;
+}
+
+QuantityArray& QuantityArray::operator+=(const PhysicalVariable v)
+{
+    if(!unit.compatible(v.getUnit()))
+        return poison(unitMismatch, "+");
+    QuantityKernels::addScalar(values.size(), values.data(), v.getValue(), values.data());
+    return *this;
+}
+
+QuantityArray& QuantityArray::operator-=(const PhysicalVariable v)
+{
+    if(!unit.compatible(v.getUnit()))
+        return poison(unitMismatch, "-");
+    QuantityKernels::addScalar(values.size(), values.data(), -v.getValue(), values.data());
+    return *this;
+}
+
+QuantityArray& QuantityArray::operator*=(const PhysicalVariable v)
+{
+    if(!unit.canMultiply(v.getUnit()))
+        return poison(unitExponentOverflow, "*");
+    unit *= v.getUnit();
+    return *this *= v.getValue();
+}
+
+QuantityArray& QuantityArray::operator/=(const PhysicalVariable v)
+{
+    if(!unit.canDivide(v.getUnit()))
+        return poison(unitExponentOverflow, "/");
+    unit /= v.getUnit();
+    return *this /= v.getValue();
+}
+
+QuantityArray& QuantityArray::operator*=(const double v)
+{
+    QuantityKernels::scale(values.size(), values.data(), v, values.data());
+    return *this;
+}
+
+QuantityArray& QuantityArray::operator/=(const double v)
+{
+    for(double& x : values)
+        x /= v;
+    return *this;
+}
+
+QuantityArray QuantityArray::pow(const signed v) const
+{
+    if(!unit.canPow(v))
+    {
+        UnitErrorPolicy::report(unitExponentOverflow, "pow");
+        return QuantityArray(Unit({}), values.size(), std::numeric_limits<double>::quiet_NaN());
+    }
+    QuantityArray result(unit.pow(v), values.size());
+    QuantityKernels::pow(values.size(), values.data(), v, result.data());
+    return result;
+}
+
+QuantityArray QuantityArray::root(const signed v) const
+{
+    Unit u({});
+    UnitStatus status = unit.tryRoot(v, u);
+    if(status != unitOk && Unit::checked)
+    {
+        UnitErrorPolicy::report(status, "root");
+        return QuantityArray(Unit({}), values.size(), std::numeric_limits<double>::quiet_NaN());
+    }
+    QuantityArray result(u, values.size());
+    QuantityKernels::root(values.size(), values.data(), v, result.data());
+    return result;
+}
+
+QuantityArray QuantityArray::operator+(const QuantityArray& a) const
+{
+    return QuantityArray(*this) += a;
+}
+
+QuantityArray QuantityArray::operator-(const QuantityArray& a) const
+{
+    return QuantityArray(*this) -= a;
+}
+
+QuantityArray QuantityArray::operator*(const QuantityArray& a) const
+{
+    return QuantityArray(*this) *= a;
+}
+
+QuantityArray QuantityArray::operator/(const QuantityArray& a) const
+{
+    return QuantityArray(*this) /= a;
+}
+
+QuantityArray QuantityArray::operator+(const PhysicalVariable v) const
+{
+    return QuantityArray(*this) += v;
+}
+
+QuantityArray QuantityArray::operator-(const PhysicalVariable v) const
+{
+    return QuantityArray(*this) -= v;
+}
+
+QuantityArray QuantityArray::operator*(const PhysicalVariable v) const
+{
+    return QuantityArray(*this) *= v;
+}
+
+QuantityArray QuantityArray::operator/(const PhysicalVariable v) const
+{
+    return QuantityArray(*this) /= v;
+}
+
+QuantityArray QuantityArray::operator*(const double v) const
+{
+    return QuantityArray(*this) *= v;
+}
+
+QuantityArray QuantityArray::operator/(const double v) const
+{
+    return QuantityArray(*this) /= v;
+}
+
+namespace
+{
+    typedef void (*BinaryKernel)(std::size_t, const double*, const double*, double*);
+
+    QuantityArray combine(const QuantityView& a, const QuantityView& b, bool valid, UnitStatus status,
+                          const char* operation, Unit unit, BinaryKernel kernel)
+    {
+        if(a.size() != b.size())
+            throw std::length_error("QuantityArrays of different sizes");
+        if(!valid)
+        {
+            UnitErrorPolicy::report(status, operation);
+            return QuantityArray(Unit({}), a.size(), std::numeric_limits<double>::quiet_NaN());
+        }
+        QuantityArray result(unit, a.size());
+        kernel(a.size(), a.data(), b.data(), result.data());
+        return result;
+    }
+}
+
+QuantityArray operator+(const QuantityView& a, const QuantityView& b)
+{
+    return combine(a, b, a.getUnit().compatible(b.getUnit()), unitMismatch, "+", a.getUnit(), QuantityKernels::add);
+}
+
+QuantityArray operator-(const QuantityView& a, const QuantityView& b)
+{
+    return combine(a, b, a.getUnit().compatible(b.getUnit()), unitMismatch, "-", a.getUnit(), QuantityKernels::subtract);
+}
+
+QuantityArray operator*(const QuantityView& a, const QuantityView& b)
+{
+    const bool valid = a.getUnit().canMultiply(b.getUnit());
+    return combine(a, b, valid, unitExponentOverflow, "*", valid ? a.getUnit() * b.getUnit() : Unit({}), QuantityKernels::multiply);
+}
+
+QuantityArray operator/(const QuantityView& a, const QuantityView& b)
+{
+    const bool valid = a.getUnit().canDivide(b.getUnit());
+    return combine(a, b, valid, unitExponentOverflow, "/", valid ? a.getUnit() / b.getUnit() : Unit({}), QuantityKernels::divide);
+}
+
+QuantityArray operator*(const PhysicalVariable v, const QuantityArray& a)
+{
+    return a * v;
+}
+
+QuantityArray operator/(const PhysicalVariable v, const QuantityArray& a)
+{
+    if(!v.getUnit().canDivide(a.getUnit()))
+    {
+        UnitErrorPolicy::report(unitExponentOverflow, "/");
+        return QuantityArray(Unit({}), a.size(), std::numeric_limits<double>::quiet_NaN());
+    }
+    QuantityArray result(v.getUnit() / a.getUnit(), a.size());
+    const double x = v.getValue();
+    const double* y = a.data();
+    double* r = result.data();
+    for(std::size_t i = 0, n = a.size(); i < n; i++)
+        r[i] = x / y[i];
+    return result;
+}
+
+QuantityArray operator*(const double v, const QuantityArray& a)
+{
+    return a * v;
+}
+
+QuantityArray operator/(const double v, const QuantityArray& a)
+{
+    return PhysicalVariable(v, Unit({})) / a;
+}
@@ -0,0 +1,182 @@
+#ifndef C11QUANTITYARRAY_H_INCLUDED
+#define C11QUANTITYARRAY_H_INCLUDED
+
+#include <cstddef>
+#include <vector>
+#include "C11Units.h"
+
+/// Many values that share one Unit, stored as a contiguous buffer of doubles.
+/// Arithmetic checks the units once per array and then runs over plain
+/// doubles. Unit errors go through UnitErrorPolicy like those of
+/// PhysicalVariable; without exceptions the result is NaN and dimensionless.
+/// Arrays of different sizes throw std::length_error.
+class QuantityArray;
+
+/// A read-only window into contiguous values that share one Unit, usually
+/// part of a QuantityArray. It does not own the values, so it must not
+/// outlive them. Arithmetic on views creates a new QuantityArray.
+class QuantityView
+{
+public:
+    QuantityView(const double* values, std::size_t size, Unit unit) : values(values), count(size), unit(unit) {}
+    QuantityView(const QuantityArray& a);
+
+    Unit getUnit() const
+    {
+        return unit;
+    }
+
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    const double* data() const
+    {
+        return values;
+    }
+
+    PhysicalVariable operator[](std::size_t i) const
+    {
+        return PhysicalVariable(values[i], unit);
+    }
+
+    /// Rows [begin, end), clamped to the view.
+    QuantityView slice(std::size_t begin, std::size_t end) const;
+
+private:
+    const double* values;
+    std::size_t count;
+    Unit unit;
+};
+
+class QuantityArray
+{
+public:
+    /// Writable element, assigning checks the unit.
+    class Element
+    {
+    public:
+        operator PhysicalVariable() const
+        {
+            return PhysicalVariable(*value, unit);
+        }
+
+        Element& operator=(const PhysicalVariable v);
+
+        Element& operator=(const Element& e)
+        {
+            return *this = static_cast<PhysicalVariable>(e);
+        }
+
+    private:
+        friend class QuantityArray;
+        Element(double* value, Unit unit) : value(value), unit(unit) {}
+
+        double* value;
+        Unit unit;
+    };
+
+    explicit QuantityArray(Unit u, std::size_t size = 0, double value = 0.);
+    QuantityArray(std::vector<double> values, Unit u);
+    /// All elements must have the same unit; an empty vector is dimensionless.
+    explicit QuantityArray(const std::vector<PhysicalVariable>& v);
+
+    /// Copies the values of a view.
+    explicit QuantityArray(const QuantityView& v);
+
+    std::vector<PhysicalVariable> toVector() const;
+
+    Unit getUnit() const
+    {
+        return unit;
+    }
+
+    std::size_t size() const
+    {
+        return values.size();
+    }
+
+    bool empty() const
+    {
+        return values.empty();
+    }
+
+    /// Values in SI units of getUnit().
+    double* data()
+    {
+        return values.data();
+    }
+
+    const double* data() const
+    {
+        return values.data();
+    }
+
+    PhysicalVariable operator[](std::size_t i) const
+    {
+        return PhysicalVariable(values[i], unit);
+    }
+
+    Element operator[](std::size_t i)
+    {
+        return Element(&values[i], unit);
+    }
+
+    void reserve(std::size_t n)
+    {
+        values.reserve(n);
+    }
+
+    void push_back(const PhysicalVariable v);
+
+    QuantityArray operator+(const QuantityArray& a) const;
+    QuantityArray operator-(const QuantityArray& a) const;
+    QuantityArray operator*(const QuantityArray& a) const;
+    QuantityArray operator/(const QuantityArray& a) const;
+    QuantityArray operator+(const PhysicalVariable v) const;
+    QuantityArray operator-(const PhysicalVariable v) const;
+    QuantityArray operator*(const PhysicalVariable v) const;
+    QuantityArray operator/(const PhysicalVariable v) const;
+    QuantityArray operator*(const double v) const;
+    QuantityArray operator/(const double v) const;
+
+    QuantityArray pow(const signed v) const;
+    QuantityArray root(const signed v) const;
+
+    QuantityArray& operator+=(const QuantityArray& a);
+    QuantityArray& operator-=(const QuantityArray& a);
+    QuantityArray& operator*=(const QuantityArray& a);
+    QuantityArray& operator/=(const QuantityArray& a);
+    QuantityArray& operator+=(const PhysicalVariable v);
+    QuantityArray& operator-=(const PhysicalVariable v);
+    QuantityArray& operator*=(const PhysicalVariable v);
+    QuantityArray& operator/=(const PhysicalVariable v);
+    QuantityArray& operator*=(const double v);
+    QuantityArray& operator/=(const double v);
+
+private:
+    /// Reports the error and turns this array into NaNs if that does not throw.
+    QuantityArray& poison(UnitStatus status, const char* operation);
+    void checkSize(const QuantityArray& a) const;
+
+    std::vector<double> values;
+    Unit unit;
+};
+
+QuantityArray operator+(const QuantityView& a, const QuantityView& b);
+QuantityArray operator-(const QuantityView& a, const QuantityView& b);
+QuantityArray operator*(const QuantityView& a, const QuantityView& b);
+QuantityArray operator/(const QuantityView& a, const QuantityView& b);
+
+QuantityArray operator*(const PhysicalVariable v, const QuantityArray& a);
+QuantityArray operator/(const PhysicalVariable v, const QuantityArray& a);
+QuantityArray operator*(const double v, const QuantityArray& a);
+QuantityArray operator/(const double v, const QuantityArray& a);
+
+#endif // C11QUANTITYARRAY_H_INCLUDED
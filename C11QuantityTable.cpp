@@ -0,0 +1,120 @@
+#include "C11QuantityTable.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+const std::size_t QuantityTable::rowGroupSize;
+
+std::size_t TableView::position(const std::string& name) const
+{
+    const std::size_t column = table->position(name);
+    for(std::size_t i = 0; i < columns.size(); i++)
+        if(columns[i] == column)
+            return i;
+    throw std::out_of_range("Column " + name + " is not part of this view");
+}
+
+const std::string& TableView::columnName(std::size_t i) const
+{
+    return table->names[columns[i]];
+}
+
+QuantityView TableView::column(std::size_t i) const
+{
+    return QuantityView(table->columns[columns[i]]).slice(begin, end);
+}
+
+QuantityView TableView::column(const std::string& name) const
+{
+    return column(position(name));
+}
+
+TableView TableView::select(const std::vector<std::string>& names) const
+{
+    std::vector<std::size_t> selected;
+    selected.reserve(names.size());
+    for(const std::string& name : names)
+        selected.push_back(columns[position(name)]);
+    return TableView(table, std::move(selected), begin, end);
+}
+
+TableView TableView::slice(std::size_t first, std::size_t last) const
+{
+    last = begin + std::min(last, end - begin);
+    first = begin + std::min(first, last - begin);
+    return TableView(table, columns, first, last);
+}
+
+std::size_t QuantityTable::position(const std::string& name) const
+{
+    auto column = index.find(name);
+    if(column == index.end())
+        throw std::out_of_range("Unknown column " + name);
+    return column->second;
+}
+
+void QuantityTable::addColumn(const std::string& name, QuantityArray column)
+{
+    auto existing = index.find(name);
+    const bool replaces = existing != index.end();
+    if(!columns.empty() && column.size() != rowCount() && !(replaces && columns.size() == 1))
+        throw std::length_error("Column " + name + " does not match the number of rows");
+    if(replaces)
+    {
+        columns[existing->second] = std::move(column);
+        return;
+    }
+    index.emplace(name, columns.size());
+    names.push_back(name);
+    columns.push_back(std::move(column));
+}
+
+void QuantityTable::removeColumn(const std::string& name)
+{
+    const std::size_t i = position(name);
+    index.erase(name);
+    names.erase(names.begin() + i);
+    columns.erase(columns.begin() + i);
+    for(auto& entry : index)
+        if(entry.second > i)
+            entry.second--;
+}
+
+const QuantityArray& QuantityTable::column(const std::string& name) const
+{
+    return columns[position(name)];
+}
+
+void QuantityTable::appendRow(const std::vector<PhysicalVariable>& row)
+{
+    if(row.size() != columns.size())
+        throw std::length_error("Row does not match the number of columns");
+    /// All units are checked before any column grows, so a throwing policy
+    /// leaves the columns at equal length.
+    for(std::size_t i = 0; i < row.size(); i++)
+        if(!columns[i].getUnit().compatible(row[i].getUnit()))
+        {
+            UnitErrorPolicy::report(unitMismatch, "appendRow");
+            break;
+        }
+    for(std::size_t i = 0; i < row.size(); i++)
+        columns[i].push_back(row[i]);
+}
+
+TableView QuantityTable::view() const
+{
+    std::vector<std::size_t> all(columns.size());
+    for(std::size_t i = 0; i < all.size(); i++)
+        all[i] = i;
+    return TableView(this, std::move(all), 0, rowCount());
+}
+
+TableView QuantityTable::select(const std::vector<std::string>& names) const
+{
+    return view().select(names);
+}
+
+TableView QuantityTable::slice(std::size_t first, std::size_t last) const
+{
+    return view().slice(first, last);
+}
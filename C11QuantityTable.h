@@ -0,0 +1,163 @@
+#ifndef C11QUANTITYTABLE_H_INCLUDED
+#define C11QUANTITYTABLE_H_INCLUDED
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "C11QuantityArray.h"
+
+class QuantityTable;
+
+/// Some columns and a range of rows of a QuantityTable, without copying.
+/// A view stays valid as long as its table keeps these columns; appending
+/// rows may move the values.
+class TableView
+{
+public:
+    std::size_t columnCount() const
+    {
+        return columns.size();
+    }
+
+    std::size_t rowCount() const
+    {
+        return end - begin;
+    }
+
+    const std::string& columnName(std::size_t i) const;
+    QuantityView column(std::size_t i) const;
+    QuantityView column(const std::string& name) const;
+
+    QuantityView operator[](const std::string& name) const
+    {
+        return column(name);
+    }
+
+    /// Projection to the named columns, in that order.
+    TableView select(const std::vector<std::string>& names) const;
+    /// Rows [first, last) of this view, clamped to it.
+    TableView slice(std::size_t first, std::size_t last) const;
+
+private:
+    friend class QuantityTable;
+    TableView(const QuantityTable* table, std::vector<std::size_t> columns, std::size_t begin, std::size_t end)
+        : table(table), columns(std::move(columns)), begin(begin), end(end) {}
+
+    std::size_t position(const std::string& name) const;
+
+    const QuantityTable* table;
+    std::vector<std::size_t> columns;
+    std::size_t begin;
+    std::size_t end;
+};
+
+/// Named columns of equal length, each a QuantityArray with its own Unit.
+/// Unknown column names throw std::out_of_range, columns of the wrong length
+/// std::length_error.
+///
+/// Derived columns are computed row group by row group, so the temporaries
+/// of an expression over several columns stay in the cache:
+///
+///     table.deriveColumn("power", [](const TableView& rows) { return rows["pressure"] * rows["flow"]; });
+class QuantityTable
+{
+public:
+    /// Rows per group; 16k doubles of a few columns fit into L2.
+    static const std::size_t rowGroupSize = 1 << 14;
+
+    std::size_t columnCount() const
+    {
+        return columns.size();
+    }
+
+    std::size_t rowCount() const
+    {
+        return columns.empty() ? 0 : columns.front().size();
+    }
+
+    bool hasColumn(const std::string& name) const
+    {
+        return index.count(name) != 0;
+    }
+
+    const std::string& columnName(std::size_t i) const
+    {
+        return names[i];
+    }
+
+    /// Adds a column or replaces the one with the same name.
+    void addColumn(const std::string& name, QuantityArray column);
+    void removeColumn(const std::string& name);
+
+    /// Columns are read-only, so they cannot grow apart; use appendRow,
+    /// addColumn or deriveColumn to change the table.
+    const QuantityArray& column(std::size_t i) const
+    {
+        return columns[i];
+    }
+
+    const QuantityArray& column(const std::string& name) const;
+
+    /// One value per column, in column order; units are checked per column.
+    void appendRow(const std::vector<PhysicalVariable>& row);
+
+    TableView view() const;
+    TableView select(const std::vector<std::string>& names) const;
+    TableView slice(std::size_t first, std::size_t last) const;
+
+    std::size_t rowGroupCount(std::size_t groupSize = rowGroupSize) const
+    {
+        return (rowCount() + groupSize - 1) / groupSize;
+    }
+
+    TableView rowGroup(std::size_t i, std::size_t groupSize = rowGroupSize) const
+    {
+        return slice(i * groupSize, (i + 1) * groupSize);
+    }
+
+    /// Adds the column name computed by f(const TableView&) -> QuantityArray
+    /// for every row group. The unit is inferred from the first group; rows
+    /// of groups with another unit become NaN if UnitErrorPolicy does not
+    /// throw. A result of the wrong length throws std::length_error.
+    template<typename F>
+    void deriveColumn(const std::string& name, F f, std::size_t groupSize = rowGroupSize)
+    {
+        std::vector<double> values;
+        values.reserve(rowCount());
+        Unit unit({});
+        const std::size_t groups = rowGroupCount(groupSize);
+        for(std::size_t g = 0; g == 0 || g < groups; g++)
+        {
+            const TableView rows = rowGroup(g, groupSize);
+            QuantityArray part = f(rows);
+            if(part.size() != rows.rowCount())
+                throw std::length_error("Column " + name + " does not match the number of rows");
+            if(g == 0)
+                unit = part.getUnit();
+            else if(!unit.compatible(part.getUnit()))
+            {
+                /// Like a cell of the wrong unit in CsvReader.
+                UnitErrorPolicy::report(unitMismatch, "deriveColumn");
+                values.insert(values.end(), part.size(), std::numeric_limits<double>::quiet_NaN());
+                continue;
+            }
+            values.insert(values.end(), part.data(), part.data() + part.size());
+        }
+        addColumn(name, QuantityArray(std::move(values), unit));
+    }
+
+private:
+    friend class TableView;
+
+    std::size_t position(const std::string& name) const;
+
+    std::vector<std::string> names;
+    std::vector<QuantityArray> columns;
+    std::unordered_map<std::string, std::size_t> index;
+};
+
+#endif // C11QUANTITYTABLE_H_INCLUDED
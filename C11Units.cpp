@@ -1,2910 +1,899 @@
 #include "C11Units.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <limits>
 
-BasicUnit::BasicUnit(std::string s, signed i) : unit(s), exp(i) {}
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
 
-bool BasicUnit::operator<(BasicUnit a) const
-{
-    if(unit.compare(a.unit) == 0)
-        return exp < a.exp;
-    else
-        return unit.compare(a.unit) < 0;
-}
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define C11UNITS_CHARCONV 1
+#endif
 
-bool BasicUnit::operator==(BasicUnit a) const
+namespace
 {
-    return (unit == a.unit && exp == a.exp);
-}
-
-Unit::Unit(std::set<BasicUnit> u) : units(u) {}
+    const char* const builtinSymbols[] = {"A", "Cd", "K", "kg", "m", "mol", "s"};
+    const unsigned builtinCount = sizeof(builtinSymbols) / sizeof(builtinSymbols[0]);
 
-Unit Unit::operator+(Unit u) const
-{
-    bool equal = true;
-    auto it2 = u.units.begin();
-    for(auto it1 = units.begin(); it1 != units.end() && it2 != u.units.end(); ++it1, ++it2)
+    struct SymbolTable
     {
-        equal &= *it1 == *it2;
-        if(!equal)
-            break;
-    }
-    if(equal)
-        return *this;
-    else
-        throw unitErrorException;
-}
+        std::mutex mutex;
+        std::string symbols[BasicUnit::capacity];
+        unsigned count = builtinCount;
+    };
 
-Unit Unit::operator*(Unit u) const
-{
-    auto units1 = units;
-    auto units2 = u.units;
-    std::set<BasicUnit> newUnits;
-    for(auto it1 = units1.begin(); it1 != units1.end(); ++it1)
+    SymbolTable& userSymbols()
     {
-        for(auto it2 = units2.begin(); it2 != units2.end() && it1 != units1.end(); ++it2)
-        {
-            if(it1->unit == it2->unit)
-            {
-                if(it1->exp + it2->exp != 0)
-                    newUnits.insert(BasicUnit(it1->unit, it1->exp + it2->exp));
-                it2 = units2.erase(it2);
-                it1 = units1.erase(it1);
-            }
-            if(it2 == units2.end() || it1 == units1.end())
-                break;
-        }
-        if(it1 == units1.end())
-            break;
+        static SymbolTable table;
+        return table;
     }
-    newUnits.insert(units1.begin(), units1.end());
-    newUnits.insert(units2.begin(), units2.end());
-    return Unit(newUnits);
-}
 
-Unit Unit::reciprocal() const
-{
-    std::set<BasicUnit> newUnits;
-    for(auto it = units.begin(); it != units.end(); ++it)
+    enum AlgebraOperation : unsigned char { noOperation, rootOperation };
+
+    struct AlgebraCacheEntry
     {
-        BasicUnit b = *it;
-        b.exp *= -1;
-        newUnits.insert(b);
-    }
-    return Unit(newUnits);
-}
+        std::uint64_t operand;
+        std::uint64_t result;
+        signed exponent;
+        AlgebraOperation operation;
+        UnitStatus status;
+    };
 
-Unit Unit::pow(signed exponent) const
-{
-    std::set<BasicUnit> newUnits;
-    for(auto it = units.begin(); it != units.end(); ++it)
+    /// Direct mapped, so a lookup is one multiplication and one compare.
+    const unsigned algebraCacheBits = 6;
+
+    struct AlgebraCache
     {
-        BasicUnit b = *it;
-        b.exp *= exponent;
-        newUnits.insert(b);
-    }
-    return Unit(newUnits);
-}
+        AlgebraCacheEntry entries[1 << algebraCacheBits];
+        Unit::CacheStatistics statistics;
+    };
 
-Unit Unit::root(signed exponent) const
-{
-    std::set<BasicUnit> newUnits;
-    for(auto it = units.begin(); it != units.end(); ++it)
+    thread_local AlgebraCache algebraCache;
+
+    struct UnitErrorState
     {
-        BasicUnit b = *it;
-        if((b.exp % exponent)!=0)
-            throw unitErrorException;
-        b.exp /= exponent;
-        newUnits.insert(b);
-    }
-    return Unit(newUnits);
-}
+        UnitErrorPolicy::Mode mode;
+        UnitStatus status;
+        const char* operation;
+    };
 
-std::string Unit::hash() const
-{
-    std::string out("");
-    for(auto it = units.begin(); it != units.end(); ++it)
+    thread_local UnitErrorState unitErrorState = {UnitErrorPolicy::throwException, unitOk, ""};
+
+    AlgebraCacheEntry& algebraCacheEntry(AlgebraOperation operation, std::uint64_t operand, signed exponent)
     {
-        out += it->unit + std::to_string(it->exp);
+        std::uint64_t key = operand ^ (static_cast<std::uint64_t>(static_cast<unsigned>(exponent)) << 8 | operation);
+        AlgebraCacheEntry& entry = algebraCache.entries[(key * 0x9E3779B97F4A7C15ULL) >> (64 - algebraCacheBits)];
+        if(entry.operation == operation && entry.operand == operand && entry.exponent == exponent)
+        {
+            ++algebraCache.statistics.hits;
+            return entry;
+        }
+        ++algebraCache.statistics.misses;
+        entry.operation = noOperation;
+        entry.operand = operand;
+        entry.exponent = exponent;
+        return entry;
     }
-    return out;
-}
 
-const std::map<std::string, std::string> Unit::mappedUnits =
-{
-    {"s-1",         "Hz"},
-    {"kg1m1s-2",    "N"},
-    {"kg1m-1s-2",   "Pa"},
-    {"kg1m2s-2",    "J"},
-    {"A1s1",        "C"},
-    {"A-1kg1m2s-3", "V"},
-    {"A2kg-1m-2s4", "F"},
-    {"A-2kg1m2s-3", "Ohm"},
-    {"A2kg-1m-2s3", "S"},
-    {"A-1kg1m2s-2", "Wb"},
-    {"A-1kg1s-2",   "T"},
-    {"A-2kg1m2s-2", "H"},
-};
+    struct DisplaySymbol
+    {
+        std::string text;
+        bool mapped;
+    };
 
+    /// Every unit printed so far. Entries are never removed, so references
+    /// to them stay valid.
+    struct DisplaySymbols
+    {
+        std::mutex mutex;
+        std::unordered_map<std::uint64_t, DisplaySymbol> symbols;
+    };
 
-std::ostream& operator<< (std::ostream& out, const Unit& u)
-{
-    auto mappedUnit = Unit::mappedUnits.find(u.hash());
-    if(mappedUnit !=  Unit::mappedUnits.end())
+    DisplaySymbols& displaySymbols()
     {
-        out << mappedUnit->second;
-        return out;
+        static DisplaySymbols table;
+        return table;
     }
-    std::string denominator;
-    std::string numerator;
-    for(auto it = u.units.begin(); it != u.units.end(); ++it)
+
+    DisplaySymbol renderDisplaySymbol(Unit u, const std::unordered_map<std::uint64_t, std::string>& mappedUnits)
     {
-        std::string exponent("");
+        auto mappedUnit = mappedUnits.find(u.signature());
+        if(mappedUnit != mappedUnits.end())
+            return DisplaySymbol{mappedUnit->second, true};
+        std::string denominator;
+        std::string numerator;
+        for(unsigned i = 0; i < Unit::lanes; ++i)
+        {
+            signed exp = u.exponent(i);
+            if(exp == 0)
+                continue;
 
-        if(abs(it->exp) != 1)
-            exponent = std::string("^") + std::to_string(abs(it->exp));
+            std::string exponent("");
 
-        if(it->exp > 0)
-            numerator += it->unit + exponent + " ";
-        else
-            denominator += it->unit + exponent + " ";
-    }
-    if(numerator == "")
-        numerator = "1 ";
-    if(denominator != "")
-        denominator = std::string("/ ") + denominator;
-    out << numerator << denominator;
-    return out;
-}
+            if(abs(exp) != 1)
+                exponent = std::string("^") + std::to_string(abs(exp));
 
-PhysicalVariable::PhysicalVariable(double v, Unit u) : value(v), unit(u) {}
+            if(exp > 0)
+                numerator += BasicUnit::symbol(i) + exponent + " ";
+            else
+                denominator += BasicUnit::symbol(i) + exponent + " ";
+        }
+        if(numerator == "")
+            numerator = "1 ";
+        if(denominator != "")
+            denominator = std::string("/ ") + denominator;
+        std::string text = numerator + denominator;
+        text.pop_back();
+        return DisplaySymbol{text, false};
+    }
 
-PhysicalVariable PhysicalVariable::operator+(const PhysicalVariable v) const
-{
-    return PhysicalVariable(this->value + v.value, unit + v.unit);
-}
+    /// A thread first looks into its own direct mapped cache, so printing
+    /// the same few units takes no lock.
+    struct DisplayCacheEntry
+    {
+        std::uint64_t signature;
+        const DisplaySymbol* symbol;
+    };
 
-PhysicalVariable PhysicalVariable::operator-(const PhysicalVariable v) const
-{
-    return PhysicalVariable(this->value - v.value, unit + v.unit);
-}
+    const unsigned displayCacheBits = 6;
 
-PhysicalVariable PhysicalVariable::operator/(const PhysicalVariable v) const
-{
-    return PhysicalVariable(this->value / v.value, unit * v.unit.reciprocal());
-}
+    thread_local DisplayCacheEntry displayCache[1 << displayCacheBits];
 
-PhysicalVariable PhysicalVariable::operator*(const PhysicalVariable v) const
-{
-    return PhysicalVariable(this->value * v.value, unit * v.unit);
-}
+    const DisplaySymbol& displaySymbolOf(Unit u, const std::unordered_map<std::uint64_t, std::string>& mappedUnits)
+    {
+        DisplayCacheEntry& entry = displayCache[(u.signature() * 0x9E3779B97F4A7C15ULL) >> (64 - displayCacheBits)];
+        if(entry.symbol && entry.signature == u.signature())
+            return *entry.symbol;
+        DisplaySymbols& table = displaySymbols();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        auto symbol = table.symbols.find(u.signature());
+        if(symbol == table.symbols.end())
+            symbol = table.symbols.emplace(u.signature(), renderDisplaySymbol(u, mappedUnits)).first;
+        entry.signature = u.signature();
+        entry.symbol = &symbol->second;
+        return symbol->second;
+    }
 
-PhysicalVariable PhysicalVariable::operator*(const double v) const
-{
-    return PhysicalVariable(this->value * v, unit);
-}
+    const char* const siPrefixes[] = {"y", "z", "a", "f", "p", "n", "mu", "m", "", "k", "M", "G", "T", "P", "E", "Z", "Y"};
+    const double siPrefixScales[] = {1e-24, 1e-21, 1e-18, 1e-15, 1e-12, 1e-9, 1e-6, 1e-3, 1e0,
+                                     1e3, 1e6, 1e9, 1e12, 1e15, 1e18, 1e21, 1e24};
+    const int siPrefixNone = 8;
+    const int siPrefixCount = sizeof(siPrefixes) / sizeof(siPrefixes[0]);
 
-PhysicalVariable PhysicalVariable::operator/(const double v) const
-{
-    return PhysicalVariable(this->value / v, unit);
-}
+    /// The index into siPrefixes for a value, without log10 and branches:
+    /// the binary exponent gives floor(log10 |x|) or one less, and one
+    /// compare against the table fixes that up.
+    int siPrefixIndex(double x)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        const int binary = static_cast<int>((bits >> 52) & 0x7FF) - 1023;
+        const int decimal = (binary * 78913) >> 18;
+        int group = (decimal + 300) / 3 - 100;
+        group = std::min(std::max(group, -siPrefixNone), siPrefixNone - 1);
+        group += std::fabs(x) >= siPrefixScales[group + siPrefixNone + 1];
+        return std::fabs(x) > 0. && std::isfinite(x) ? group + siPrefixNone : siPrefixNone;
+    }
 
-PhysicalVariable PhysicalVariable::operator+(const double v) const
-{
-    return PhysicalVariable(this->value + v, unit + Unit({}));
-}
+    struct PrefixedValue
+    {
+        double value;
+        const char* prefix;
+        /// Leading characters of the unit text to leave out, the k of kg.
+        std::size_t skip;
+    };
+
+    char* appendNumber(char* first, char* last, double value, QuantityFormat format);
+
+    /// Puts the prefix onto the first factor of the unit text, which needs an
+    /// exponent of 1; the k of kg is replaced. Returns false for units like
+    /// "1 / s" or "m^2" that take no prefix. The prefix is checked against
+    /// the value as format rounds it, so 999.9999 m becomes 1 km, not 1000 m.
+    bool withSiPrefix(double value, const std::string& symbol, QuantityFormat format, PrefixedValue& result)
+    {
+        const std::size_t head = std::min(symbol.find(' '), symbol.size());
+        if(symbol.empty() || symbol[0] == '1' || symbol.find('^') < head)
+            return false;
+        const bool kilogram = symbol.compare(0, head, "kg") == 0;
+        const double grams = kilogram ? value * 1e3 : value;
+        int index = siPrefixIndex(grams);
+        if(index + 1 < siPrefixCount && std::fabs(grams / siPrefixScales[index]) >= 999.)
+        {
+            char digits[128];
+            const char* end = appendNumber(digits, digits + sizeof(digits), grams / siPrefixScales[index], format);
+            double rounded = 0.;
+            if(end && parseNumber(digits, end, rounded) == end && std::fabs(rounded) >= 1000.)
+                index++;
+        }
+        result.value = grams / siPrefixScales[index];
+        result.prefix = siPrefixes[index];
+        result.skip = kilogram ? 1 : 0;
+        return true;
+    }
 
-PhysicalVariable PhysicalVariable::operator-(const double v) const
-{
-    return PhysicalVariable(this->value - v, unit + Unit({}));
+    int siPrefixStreamIndex()
+    {
+        static const int index = std::ios_base::xalloc();
+        return index;
+    }
 }
 
-PhysicalVariable PhysicalVariable::operator^(const signed v) const
+void UnitErrorPolicy::setMode(Mode m)
 {
-    return PhysicalVariable(value, unit.pow(v));
+    unitErrorState.mode = m;
 }
 
-PhysicalVariable PhysicalVariable::pow(const signed v) const
+UnitErrorPolicy::Mode UnitErrorPolicy::mode()
 {
-    return PhysicalVariable(std::pow(value, v), unit.pow(v));
+    return unitErrorState.mode;
 }
 
-PhysicalVariable PhysicalVariable::root(const signed v) const
+UnitStatus UnitErrorPolicy::status()
 {
-    return PhysicalVariable(std::pow(value, 1./v), unit.root(v));
+    return unitErrorState.status;
 }
 
-std::ostream& operator<< (std::ostream& out, const PhysicalVariable& pv)
+const char* UnitErrorPolicy::operation()
 {
-    out << pv.value << " " << pv.unit;
-    return out;
+    return unitErrorState.operation;
 }
 
-PhysicalVariable operator "" _pc(long double a)
+void UnitErrorPolicy::clear()
 {
-    return PhysicalVariable(a*3.0856776e16, Unit({BasicUnit("m", 1)}));
+    unitErrorState.status = unitOk;
+    unitErrorState.operation = "";
 }
 
-PhysicalVariable operator "" _pc(unsigned long long int a)
+void UnitErrorPolicy::report(UnitStatus s, const char* operation)
 {
-    return PhysicalVariable(a*3.0856776e16, Unit({BasicUnit("m", 1)}));
+    if(unitErrorState.mode == throwException)
+        throw unitErrorException;
+    if(unitErrorState.status == unitOk)
+    {
+        unitErrorState.status = s;
+        unitErrorState.operation = operation;
+    }
 }
 
-PhysicalVariable operator "" _ly(long double a)
-{
-    return PhysicalVariable(a*9460730472580800, Unit({BasicUnit("m", 1)}));
-}
+BasicUnit::BasicUnit(std::string s, signed i) : id(intern(s)), exp(i) {}
 
-PhysicalVariable operator "" _ly(unsigned long long int a)
+const char* BasicUnit::symbol() const
 {
-    return PhysicalVariable(a*9460730472580800, Unit({BasicUnit("m", 1)}));
+    return symbol(id);
 }
 
-PhysicalVariable operator "" _km(long double a)
+bool BasicUnit::operator<(BasicUnit a) const
 {
-    return PhysicalVariable(a*1000, Unit({BasicUnit("m", 1)}));
+    if(id == a.id)
+        return exp < a.exp;
+    else
+        return id < a.id;
 }
 
-PhysicalVariable operator "" _km(unsigned long long int a)
+bool BasicUnit::operator==(BasicUnit a) const
 {
-    return PhysicalVariable(a*1000, Unit({BasicUnit("m", 1)}));
+    return (id == a.id && exp == a.exp);
 }
 
-PhysicalVariable operator "" _m(long double a)
+unsigned char BasicUnit::intern(const std::string& symbol)
 {
-    return PhysicalVariable(a, Unit({BasicUnit("m", 1)}));
-}
+    for(unsigned i = 0; i < builtinCount; ++i)
+        if(symbol == builtinSymbols[i])
+            return i;
 
-PhysicalVariable operator "" _m(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 1)}));
+    SymbolTable& table = userSymbols();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    for(unsigned i = builtinCount; i < table.count; ++i)
+        if(symbol == table.symbols[i])
+            return i;
+    if(symbol.empty() || table.count == capacity)
+        throw unitErrorException;
+    table.symbols[table.count] = symbol;
+    return table.count++;
 }
 
-PhysicalVariable operator "" _dm(long double a)
+const char* BasicUnit::symbol(unsigned char id)
 {
-    return PhysicalVariable(a/10, Unit({BasicUnit("m", 1)}));
+    if(id < builtinCount)
+        return builtinSymbols[id];
+    return userSymbols().symbols[id].c_str();
 }
 
-PhysicalVariable operator "" _dm(unsigned long long int a)
+Unit::Unit(std::set<BasicUnit> u) : exponents(0)
 {
-    return PhysicalVariable(a/10, Unit({BasicUnit("m", 1)}));
+    for(auto it = u.begin(); it != u.end(); ++it)
+    {
+        unsigned i = it->id;
+        exponents = (exponents & ~pack(i, -1)) | pack(i, exponent(i) + it->exp);
+    }
 }
 
-PhysicalVariable operator "" _cm(long double a)
+UnitStatus Unit::tryRoot(signed exponent, Unit& result) const
 {
-    return PhysicalVariable(a/100, Unit({BasicUnit("m", 1)}));
+    AlgebraCacheEntry& entry = algebraCacheEntry(rootOperation, exponents, exponent);
+    if(entry.operation == noOperation)
+    {
+        entry.result = 0;
+        entry.status = exponent != 0 ? unitOk : unitNonIntegralRoot;
+        for(unsigned i = 0; i < lanes && entry.status == unitOk; ++i)
+        {
+            signed e = this->exponent(i);
+            if((e % exponent)!=0)
+                entry.status = unitNonIntegralRoot;
+            else
+                entry.result |= pack(i, e / exponent);
+        }
+        entry.operation = rootOperation;
+    }
+    if(entry.status == unitOk)
+        result = Unit(entry.result);
+    return entry.status;
 }
 
-PhysicalVariable operator "" _cm(unsigned long long int a)
+Unit Unit::root(signed exponent) const
 {
-    return PhysicalVariable(a/100, Unit({BasicUnit("m", 1)}));
+    Unit result({});
+    UnitStatus status = tryRoot(exponent, result);
+    if(checked && status != unitOk)
+        UnitErrorPolicy::report(status, "root");
+    return result;
 }
 
-PhysicalVariable operator "" _mm(long double a)
+Unit::CacheStatistics Unit::cacheStatistics()
 {
-    return PhysicalVariable(a/1000, Unit({BasicUnit("m", 1)}));
+    return algebraCache.statistics;
 }
 
-PhysicalVariable operator "" _mm(unsigned long long int a)
+void Unit::resetCacheStatistics()
 {
-    return PhysicalVariable(a/1000, Unit({BasicUnit("m", 1)}));
+    algebraCache.statistics = CacheStatistics();
 }
 
-PhysicalVariable operator "" _mum(long double a)
+std::string Unit::hash() const
 {
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 1)}));
+    std::string out("");
+    for(unsigned i = 0; i < lanes; ++i)
+    {
+        if(exponent(i) != 0)
+            out += BasicUnit::symbol(i) + std::to_string(exponent(i));
+    }
+    return out;
 }
 
-PhysicalVariable operator "" _mum(unsigned long long int a)
+const std::string& Unit::displaySymbol() const
 {
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 1)}));
+    return displaySymbolOf(*this, mappedUnits).text;
 }
 
-PhysicalVariable operator "" _nm(long double a)
+const std::unordered_map<std::uint64_t, std::string> Unit::mappedUnits =
 {
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 1)}));
-}
+    {Unit(BasicUnit::s, -1).signature(), "Hz"},
+    {Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2).signature(), "N"},
+    {Unit(BasicUnit::kg, 1, BasicUnit::m, -1, BasicUnit::s, -2).signature(), "Pa"},
+    {Unit(BasicUnit::kg, 1, BasicUnit::m, 2, BasicUnit::s, -2).signature(), "J"},
+    {Unit(BasicUnit::A, 1, BasicUnit::s, 1).signature(), "C"},
+    {Unit(BasicUnit::A, -1, BasicUnit::kg, 1, BasicUnit::m, 2, BasicUnit::s, -3).signature(), "V"},
+    {Unit(BasicUnit::A, 2, BasicUnit::kg, -1, BasicUnit::m, -2, BasicUnit::s, 4).signature(), "F"},
+    {Unit(BasicUnit::A, -2, BasicUnit::kg, 1, BasicUnit::m, 2, BasicUnit::s, -3).signature(), "Ohm"},
+    {Unit(BasicUnit::A, 2, BasicUnit::kg, -1, BasicUnit::m, -2, BasicUnit::s, 3).signature(), "S"},
+    {Unit(BasicUnit::A, -1, BasicUnit::kg, 1, BasicUnit::m, 2, BasicUnit::s, -2).signature(), "Wb"},
+    {Unit(BasicUnit::A, -1, BasicUnit::kg, 1, BasicUnit::s, -2).signature(), "T"},
+    {Unit(BasicUnit::A, -2, BasicUnit::kg, 1, BasicUnit::m, 2, BasicUnit::s, -2).signature(), "H"},
+};
 
-PhysicalVariable operator "" _nm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 1)}));
-}
 
-PhysicalVariable operator "" _pm(long double a)
+std::ostream& operator<< (std::ostream& out, const Unit& u)
 {
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 1)}));
+    const DisplaySymbol& symbol = displaySymbolOf(u, Unit::mappedUnits);
+    out << symbol.text;
+    if(!symbol.mapped)
+        out << ' ';
+    return out;
 }
 
-PhysicalVariable operator "" _pm(unsigned long long int a)
+PhysicalVariable PhysicalVariable::poisoned(UnitStatus status, const char* operation)
 {
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 1)}));
+    UnitErrorPolicy::report(status, operation);
+    return PhysicalVariable(std::numeric_limits<double>::quiet_NaN(), Unit({}));
 }
 
-PhysicalVariable operator "" _fm(long double a)
+UnitStatus PhysicalVariable::tryRoot(const signed v, PhysicalVariable& result) const
 {
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 1)}));
+#ifndef C11UNITS_UNCHECKED
+    Unit u({});
+    UnitStatus status = unit.tryRoot(v, u);
+    if(status != unitOk)
+        return status;
+    result = PhysicalVariable(std::pow(value, 1./v), u);
+#else
+    result = PhysicalVariable(std::pow(value, 1./v), Unit({}));
+#endif
+    return unitOk;
 }
 
-PhysicalVariable operator "" _fm(unsigned long long int a)
+PhysicalVariable PhysicalVariable::root(const signed v) const
 {
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 1)}));
+    PhysicalVariable result(0, Unit({}));
+    UnitStatus status = tryRoot(v, result);
+    return status == unitOk ? result : poisoned(status, "root");
 }
 
-PhysicalVariable operator "" _am(long double a)
+std::ostream& siPrefixes(std::ostream& out)
 {
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 1)}));
+    out.iword(siPrefixStreamIndex()) = 1;
+    return out;
 }
 
-PhysicalVariable operator "" _am(unsigned long long int a)
+std::ostream& noSiPrefixes(std::ostream& out)
 {
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 1)}));
+    out.iword(siPrefixStreamIndex()) = 0;
+    return out;
 }
 
-PhysicalVariable operator "" _zm(long double a)
+std::ostream& operator<< (std::ostream& out, const PhysicalVariable& pv)
 {
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 1)}));
+#ifndef C11UNITS_UNCHECKED
+    PrefixedValue prefixed;
+    if(out.iword(siPrefixStreamIndex()) != 0)
+    {
+        const DisplaySymbol& symbol = displaySymbolOf(pv.unit, Unit::mappedUnits);
+        const std::ios_base::fmtflags notation = out.flags() & std::ios_base::floatfield;
+        const QuantityFormat format(notation == std::ios_base::fixed ? QuantityFormat::fixed
+                                    : notation == std::ios_base::scientific ? QuantityFormat::scientific
+                                    : QuantityFormat::general, static_cast<int>(out.precision()));
+        if(withSiPrefix(pv.value, symbol.text, format, prefixed))
+        {
+            out << prefixed.value << " " << prefixed.prefix << symbol.text.c_str() + prefixed.skip;
+            if(!symbol.mapped)
+                out << ' ';
+            return out;
+        }
+    }
+    out << pv.value << " " << pv.unit;
+#else
+    out << pv.value;
+#endif
+    return out;
 }
 
-PhysicalVariable operator "" _zm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 1)}));
-}
+#define C11UNITS_SYMBOL(suffix, value, unit) \
+    {#suffix, operator "" _##suffix(1.0L).getValue() - operator "" _##suffix(0.0L).getValue(), \
+     operator "" _##suffix(0.0L).getValue(), operator "" _##suffix(0.0L).getUnit()},
 
-PhysicalVariable operator "" _ym(long double a)
+namespace
 {
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 1)}));
+    constexpr UnitSymbol unitSymbols[] = { C11UNITS_LITERALS(C11UNITS_SYMBOL) };
+    constexpr std::size_t unitSymbolCount = sizeof(unitSymbols) / sizeof(unitSymbols[0]);
 }
 
-PhysicalVariable operator "" _ym(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 1)}));
-}
+#undef C11UNITS_SYMBOL
 
-PhysicalVariable operator "" _a(long double a)
+namespace
 {
-    return PhysicalVariable(a*31557600, Unit({BasicUnit("s", 1)}));
-}
+    std::uint32_t symbolHash(const char* name, std::size_t length)
+    {
+        std::uint32_t hash = 2166136261u;
+        for(std::size_t i = 0; i < length; i++)
+            hash = (hash ^ static_cast<unsigned char>(name[i])) * 16777619u;
+        return hash;
+    }
 
-PhysicalVariable operator "" _a(unsigned long long int a)
-{
-    return PhysicalVariable(a*31557600, Unit({BasicUnit("s", 1)}));
-}
+    /// Open addressing over unitSymbols with at least twice as many slots as
+    /// symbols, so a lookup hashes the name once and mostly compares a single
+    /// entry. A slot holds the index of a symbol plus one, 0 if it is empty.
+    /// Of two literals with the same name the first one wins.
+    class SymbolIndex
+    {
+    public:
+        SymbolIndex()
+        {
+            std::fill(slots, slots + slotCount, 0);
+            for(std::size_t i = 0; i < unitSymbolCount; i++)
+            {
+                const char* name = unitSymbols[i].name;
+                const std::size_t length = std::strlen(name);
+                std::size_t slot = symbolHash(name, length) & (slotCount - 1);
+                for(; slots[slot] != 0; slot = (slot + 1) & (slotCount - 1))
+                    if(matches(slots[slot], name, length))
+                        break;
+                if(slots[slot] == 0)
+                    slots[slot] = static_cast<std::uint16_t>(i + 1);
+            }
+        }
 
-PhysicalVariable operator "" _d(long double a)
-{
-    return PhysicalVariable(a*86400, Unit({BasicUnit("s", 1)}));
-}
+        const UnitSymbol* find(const char* name, std::size_t length) const
+        {
+            for(std::size_t slot = symbolHash(name, length) & (slotCount - 1); slots[slot] != 0;
+                slot = (slot + 1) & (slotCount - 1))
+                if(matches(slots[slot], name, length))
+                    return unitSymbols + slots[slot] - 1;
+            return nullptr;
+        }
 
-PhysicalVariable operator "" _d(unsigned long long int a)
-{
-    return PhysicalVariable(a*86400, Unit({BasicUnit("s", 1)}));
-}
+    private:
+        static const std::size_t slotCount = 1024;
+        static_assert(slotCount >= 2 * unitSymbolCount, "The symbol index needs more slots");
 
-PhysicalVariable operator "" _h(long double a)
-{
-    return PhysicalVariable(a*3600, Unit({BasicUnit("s", 1)}));
-}
+        static bool matches(std::uint16_t slot, const char* name, std::size_t length)
+        {
+            const char* candidate = unitSymbols[slot - 1].name;
+            return std::strlen(candidate) == length && std::memcmp(candidate, name, length) == 0;
+        }
 
-PhysicalVariable operator "" _h(unsigned long long int a)
-{
-    return PhysicalVariable(a*3600, Unit({BasicUnit("s", 1)}));
-}
+        std::uint16_t slots[slotCount];
+    };
 
-PhysicalVariable operator "" _min(long double a)
-{
-    return PhysicalVariable(a*60, Unit({BasicUnit("s", 1)}));
-}
+    const SymbolIndex& symbolIndex()
+    {
+        static const SymbolIndex index;
+        return index;
+    }
 
-PhysicalVariable operator "" _min(unsigned long long int a)
-{
-    return PhysicalVariable(a*60, Unit({BasicUnit("s", 1)}));
-}
+    const double powersOf10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
 
-PhysicalVariable operator "" _s(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("s", 1)}));
-}
+    inline bool isDigit(char c)
+    {
+        return static_cast<unsigned>(c - '0') < 10;
+    }
 
-PhysicalVariable operator "" _s(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("s", 1)}));
-}
+    inline bool isBlank(char c)
+    {
+        return c == ' ' || c == '\t';
+    }
 
-PhysicalVariable operator "" _ms(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("s", 1)}));
-}
+    /// Adds the digits at [p, last) to mantissa and returns where they end.
+    /// Only the lowest 64 bits are kept.
+    inline const char* addDigits(const char* p, const char* last, std::uint64_t& mantissa)
+    {
+        for(; p != last && isDigit(*p); p++)
+            mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+        return p;
+    }
 
-PhysicalVariable operator "" _ms(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("s", 1)}));
-}
+    /// Overflow gives +/- HUGE_VAL and underflow the nearest denormal or 0.
+    double parseWithStrtod(const char* first, const char* last)
+    {
+        char buffer[64];
+        if(static_cast<std::size_t>(last - first) < sizeof(buffer))
+        {
+            std::memcpy(buffer, first, last - first);
+            buffer[last - first] = '\0';
+            return std::strtod(buffer, nullptr);
+        }
+        return std::strtod(std::string(first, last).c_str(), nullptr);
+    }
 
-PhysicalVariable operator "" _mus(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("s", 1)}));
-}
+    double parseSlowly(const char* first, const char* last)
+    {
+        if(*first == '+')
+            first++;
+#ifdef C11UNITS_CHARCONV
+        /// from_chars leaves the value alone if it is out of range, strtod
+        /// decides how it rounds in either build.
+        double value = 0.;
+        if(std::from_chars(first, last, value).ec == std::errc())
+            return value;
+#endif
+        return parseWithStrtod(first, last);
+    }
 
-PhysicalVariable operator "" _mus(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("s", 1)}));
-}
+    inline bool isSymbolCharacter(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+    }
 
-PhysicalVariable operator "" _ns(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("s", 1)}));
-}
+    /// The lane of a base or user defined symbol without interning it, or -1.
+    int baseSymbol(const char* name, std::size_t length)
+    {
+        for(unsigned i = 0; i < builtinCount; ++i)
+            if(std::strlen(builtinSymbols[i]) == length && std::memcmp(builtinSymbols[i], name, length) == 0)
+                return i;
+        SymbolTable& table = userSymbols();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        for(unsigned i = builtinCount; i < table.count; ++i)
+            if(table.symbols[i].compare(0, std::string::npos, name, length) == 0)
+                return i;
+        return -1;
+    }
 
-PhysicalVariable operator "" _ns(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("s", 1)}));
-}
+    /// Base symbols, the names operator<< prints and the literals without a
+    /// scale, such as W. Returns false for unknown names.
+    bool namedUnit(const char* name, std::size_t length, const std::unordered_map<std::uint64_t, std::string>& mappedUnits,
+                   Unit& unit)
+    {
+        const int lane = baseSymbol(name, length);
+        if(lane >= 0)
+        {
+            unit = Unit(std::uint64_t(1) << (8 * lane));
+            return true;
+        }
+        for(auto mapped = mappedUnits.begin(); mapped != mappedUnits.end(); ++mapped)
+        {
+            if(mapped->second.compare(0, std::string::npos, name, length) == 0)
+            {
+                unit = Unit(mapped->first);
+                return true;
+            }
+        }
+        const UnitSymbol* symbol = symbolIndex().find(name, length);
+        if(symbol && symbol->scale == 1. && symbol->offset == 0.)
+        {
+            unit = symbol->unit;
+            return true;
+        }
+        return false;
+    }
 
-PhysicalVariable operator "" _ps(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("s", 1)}));
-}
+    struct UnitTextCacheEntry
+    {
+        char text[32];
+        std::size_t length;
+        std::uint64_t signature;
+    };
 
-PhysicalVariable operator "" _ps(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("s", 1)}));
-}
+    /// Direct mapped like the algebra cache. Texts longer than an entry are
+    /// parsed every time.
+    const unsigned unitTextCacheBits = 6;
 
-PhysicalVariable operator "" _fs(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("s", 1)}));
-}
+    thread_local UnitTextCacheEntry unitTextCache[1 << unitTextCacheBits];
 
-PhysicalVariable operator "" _fs(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("s", 1)}));
-}
+    char* append(char* first, char* last, const char* text, std::size_t length)
+    {
+        if(!first || static_cast<std::size_t>(last - first) < length)
+            return nullptr;
+        std::memcpy(first, text, length);
+        return first + length;
+    }
 
-PhysicalVariable operator "" _as(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("s", 1)}));
+    char* appendNumber(char* first, char* last, double value, QuantityFormat format)
+    {
+        if(last <= first)
+            return nullptr;
+#ifdef C11UNITS_CHARCONV
+        const std::chars_format notation = format.notation == QuantityFormat::fixed ? std::chars_format::fixed
+                                         : format.notation == QuantityFormat::scientific ? std::chars_format::scientific
+                                         : std::chars_format::general;
+        const std::to_chars_result result = format.precision < 0
+            ? (format.notation == QuantityFormat::general ? std::to_chars(first, last, value) : std::to_chars(first, last, value, notation))
+            : std::to_chars(first, last, value, notation, format.precision);
+        return result.ec == std::errc() ? result.ptr : nullptr;
+#else
+        const char* const specs[] = {"%.*g", "%.*f", "%.*e"};
+        const int precision = format.precision >= 0 ? format.precision : 17;
+        const int length = std::snprintf(first, last - first, specs[format.notation], precision, value);
+        return length >= 0 && length < last - first ? first + length : nullptr;
+#endif
+    }
 }
 
-PhysicalVariable operator "" _as(unsigned long long int a)
+const UnitSymbol* UnitSymbol::find(const std::string& name)
 {
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("s", 1)}));
+    return symbolIndex().find(name.data(), name.size());
 }
 
-PhysicalVariable operator "" _zs(long double a)
+const UnitSymbol* UnitSymbol::find(const char* name, std::size_t length)
 {
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("s", 1)}));
+    return symbolIndex().find(name, length);
 }
 
-PhysicalVariable operator "" _zs(unsigned long long int a)
+const UnitSymbol* UnitSymbol::begin()
 {
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("s", 1)}));
+    return unitSymbols;
 }
 
-PhysicalVariable operator "" _ys(long double a)
+const UnitSymbol* UnitSymbol::end()
 {
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("s", 1)}));
+    return unitSymbols + unitSymbolCount;
 }
 
-PhysicalVariable operator "" _ys(unsigned long long int a)
+const char* parseNumber(const char* first, const char* last, double& value)
 {
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("s", 1)}));
-}
+    const char* p = first;
+    bool negative = false;
+    if(p != last && (*p == '-' || *p == '+'))
+        negative = *p++ == '-';
 
-PhysicalVariable operator "" _kg(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("kg", 1)}));
-}
+    /// The digits are summed without any overflow check; more than 19 of
+    /// them take the slow path below, which does not use the sum.
+    std::uint64_t mantissa = 0;
+    const char* const integer = p;
+    p = addDigits(p, last, mantissa);
+    std::size_t count = p - integer;
+    const char* fraction = p;
+    if(p != last && *p == '.')
+    {
+        fraction = ++p;
+        p = addDigits(p, last, mantissa);
+    }
+    count += p - fraction;
+    if(count == 0)
+        return first;
+    int exponent = -static_cast<int>(p - fraction);
 
-PhysicalVariable operator "" _kg(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("kg", 1)}));
-}
+    if(p != last && (*p == 'e' || *p == 'E'))
+    {
+        const char* e = p + 1;
+        bool negativeExponent = false;
+        if(e != last && (*e == '-' || *e == '+'))
+            negativeExponent = *e++ == '-';
+        if(e != last && isDigit(*e))
+        {
+            int n = 0;
+            for(; e != last && isDigit(*e); e++)
+                n = n < 100000 ? n * 10 + (*e - '0') : n;
+            exponent += negativeExponent ? -n : n;
+            p = e;
+        }
+    }
 
-PhysicalVariable operator "" _g(unsigned long long int a)
-{
-    return PhysicalVariable(a/1000, Unit({BasicUnit("kg", 1)}));
+    /// Up to 19 digits and 10^22 are exact, so one rounding step gives the
+    /// correctly rounded result. Everything else takes the slow path.
+    if(count <= 19 && mantissa <= (std::uint64_t(1) << 53) && exponent >= -22 && exponent <= 22)
+    {
+        double x = static_cast<double>(mantissa);
+        x = exponent < 0 ? x / powersOf10[-exponent] : x * powersOf10[exponent];
+        value = negative ? -x : x;
+    }
+    else
+        value = parseSlowly(first, p);
+    return p;
+}
+
+PhysicalVariable parseQuantity(const char* text, std::size_t length)
+{
+    const char* const last = text + length;
+    const char* p = text;
+    while(p != last && isBlank(*p))
+        p++;
+    double value;
+    const char* number = p;
+    p = parseNumber(p, last, value);
+    if(p == number)
+        throw UnitParseError("Expected a number", number - text);
+    while(p != last && isBlank(*p))
+        p++;
+    const char* symbol = p;
+    while(p != last && !isBlank(*p))
+        p++;
+    const char* symbolEnd = p;
+    while(p != last && isBlank(*p))
+        p++;
+    if(symbol == symbolEnd)
+        return PhysicalVariable(value, Unit({}));
+    if(p == last)
+    {
+        const UnitSymbol* unit = symbolIndex().find(symbol, symbolEnd - symbol);
+        if(unit)
+            return (*unit)(value);
+    }
+    /// Not a literal, so it has to be a unit as operator<< prints it.
+    const char* end = last;
+    while(isBlank(end[-1]))
+        end--;
+    try
+    {
+        return PhysicalVariable(value, parseUnit(symbol, end - symbol));
+    }
+    catch(const UnitParseError& error)
+    {
+        throw UnitParseError(error.what(), symbol - text + error.position());
+    }
 }
 
-PhysicalVariable operator "" _g(long double a)
+Unit parseUnit(const char* text, std::size_t length)
 {
-    return PhysicalVariable(a/1000, Unit({BasicUnit("kg", 1)}));
-}
+    const char* const last = text + length;
+    UnitTextCacheEntry& entry = unitTextCache[(symbolHash(text, length) * 0x9E3779B97F4A7C15ULL) >> (64 - unitTextCacheBits)];
+    if(length != 0 && entry.length == length && std::memcmp(entry.text, text, length) == 0)
+        return Unit(entry.signature);
 
-PhysicalVariable operator "" _mg(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("kg", 1)}));
-}
+    signed exponents[Unit::lanes] = {};
+    /// The exponent of the last factor that changed a lane, for errors.
+    const char* lastExponent[Unit::lanes] = {};
+    const char* slash = nullptr;
+    bool denominator = false;
+    bool any = false;
+    bool divisor = false;
+    const char* p = text;
+    for(;;)
+    {
+        while(p != last && (isBlank(*p) || *p == '*'))
+            p++;
+        if(p == last)
+            break;
+        if(*p == '/' && !denominator)
+        {
+            denominator = true;
+            slash = p++;
+            continue;
+        }
+        if(*p == '1' && (p + 1 == last || !(isDigit(p[1]) || isSymbolCharacter(p[1]) || p[1] == '^')))
+        {
+            any = true;
+            divisor = denominator;
+            p++;
+            continue;
+        }
+        if(!isSymbolCharacter(*p))
+            throw UnitParseError("Unexpected character", p - text);
+
+        const char* name = p;
+        while(p != last && isSymbolCharacter(*p))
+            p++;
+        Unit unit({});
+        if(!namedUnit(name, p - name, Unit::mappedUnits, unit))
+            throw UnitParseError("Unknown unit symbol", name - text);
+
+        signed exponent = 1;
+        const bool caret = p != last && *p == '^';
+        const char* digits = caret ? p + 1 : p;
+        bool negative = false;
+        if(digits != last && (*digits == '-' || *digits == '+'))
+            negative = *digits++ == '-';
+        if(digits != last && isDigit(*digits))
+        {
+            exponent = 0;
+            for(p = digits; p != last && isDigit(*p); p++)
+                exponent = exponent < 1000 ? exponent * 10 + (*p - '0') : exponent;
+            exponent = negative ? -exponent : exponent;
+        }
+        else if(caret || digits != p)
+            throw UnitParseError("Expected an exponent", digits - text);
+        if(denominator)
+            exponent = -exponent;
+        for(unsigned i = 0; i < Unit::lanes; ++i)
+        {
+            exponents[i] += exponent * unit.exponent(i);
+            lastExponent[i] = unit.exponent(i) != 0 ? (digits != p ? digits : name) : lastExponent[i];
+        }
+        any = true;
+        divisor = denominator;
+    }
+    if(!any)
+        throw UnitParseError("Expected a unit", p - text);
+    if(denominator && !divisor)
+        throw UnitParseError("Expected a unit after '/'", slash - text);
 
-PhysicalVariable operator "" _mg(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("kg", 1)}));
+    std::uint64_t signature = 0;
+    for(unsigned i = 0; i < Unit::lanes; ++i)
+    {
+        if(exponents[i] < std::numeric_limits<std::int8_t>::min() || exponents[i] > std::numeric_limits<std::int8_t>::max())
+            throw UnitParseError("Exponent out of range", lastExponent[i] - text);
+        signature |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(exponents[i])) << (8 * i);
+    }
+    if(length <= sizeof(entry.text))
+    {
+        std::memcpy(entry.text, text, length);
+        entry.length = length;
+        entry.signature = signature;
+    }
+    return Unit(signature);
 }
 
-PhysicalVariable operator "" _mug(unsigned long long int a)
+char* formatTo(char* first, char* last, Unit unit)
 {
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("kg", 1)}));
+    const std::string& symbol = unit.displaySymbol();
+    return append(first, last, symbol.data(), symbol.size());
 }
 
-PhysicalVariable operator "" _mug(long double a)
+char* formatTo(char* first, char* last, const PhysicalVariable& pv, QuantityFormat format)
 {
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _ng(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _ng(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _pg(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _pg(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _fg(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _fg(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _ag(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _ag(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _zg(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _zg(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _yg(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-27, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _yg(long double a)
-{
-    return PhysicalVariable(a*1e-27, Unit({BasicUnit("kg", 1)}));
-}
-
-
-PhysicalVariable operator "" _deg(long double a)
-{
-    return PhysicalVariable(M_PI*a/180, Unit({}));
-}
-
-PhysicalVariable operator "" _deg(unsigned long long int a)
-{
-    return PhysicalVariable(M_PI*a/180, Unit({}));
-}
-
-PhysicalVariable operator "" _degMin(long double a)
-{
-    return PhysicalVariable(M_PI*a/10800, Unit({}));
-}
-
-PhysicalVariable operator "" _degMin(unsigned long long int a)
-{
-    return PhysicalVariable(M_PI*a/10800, Unit({}));
-}
-
-PhysicalVariable operator "" _degSec(long double a)
-{
-    return PhysicalVariable(M_PI*a/648000, Unit({}));
-}
-
-PhysicalVariable operator "" _degSec(unsigned long long int a)
-{
-    return PhysicalVariable(M_PI*a/648000, Unit({}));
-}
-
-PhysicalVariable operator "" _kl(long double a)
-{
-    return PhysicalVariable(a*1000, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _kl(unsigned long long int a)
-{
-    return PhysicalVariable(a*1000, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _hl(long double a)
-{
-    return PhysicalVariable(a*100, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _hl(unsigned long long int a)
-{
-    return PhysicalVariable(a*100, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _l(long double a)
-{
-    return PhysicalVariable(a/1000, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _l(unsigned long long int a)
-{
-    return PhysicalVariable(a/1000, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _ml(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _ml(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _mul(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _mul(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _nl(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _nl(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", -3)}));
-}
-
-PhysicalVariable operator "" _t(long double a)
-{
-    return PhysicalVariable(a*1000, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _t(unsigned long long int a)
-{
-    return PhysicalVariable(a*1000, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _meV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e-22, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _meV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e-22, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _eV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e-19, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _eV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e-19, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _keV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e-16, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _keV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e-16, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _MeV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e-13, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _MeV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e-13, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _GeV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e-10, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _GeV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e-10, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _TeV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e-7, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _TeV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e-7, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _PeV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e-4, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _PeV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e-4, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _EeV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e-1, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _EeV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e-1, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _ZeV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e2, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _ZeV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e2, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _YeV(long double a)
-{
-    return PhysicalVariable(a*1.602176565e5, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _YeV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.602176565e5, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _u(long double a)
-{
-    return PhysicalVariable(a*1.660538921e-27, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _u(unsigned long long int a)
-{
-    return PhysicalVariable(a*1.660538921e-27, Unit({BasicUnit("kg", 1)}));
-}
-
-PhysicalVariable operator "" _yN(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _yN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _zN(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _zN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _aN(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _aN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _fN(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _fN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _pN(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _pN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _nN(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _nN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _muN(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _muN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _mN(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _mN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _N(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _N(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _kN(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _kN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _MN(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _MN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _GN(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _GN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _TN(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _TN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _PN(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _PN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _EN(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _EN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _ZN(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _ZN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _YN(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _YN(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("kg", 1), BasicUnit("m", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _yA(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _yA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _zA(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _zA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _aA(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _aA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _fA(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _fA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _pA(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _pA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _nA(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _nA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _muA(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _muA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _mA(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _mA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _A(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _A(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _kA(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _kA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _MA(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _MA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _GA(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _GA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _TA(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _TA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _PA(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _PA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _EA(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _EA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _ZA(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _ZA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _YA(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _YA(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("A", 1)}));
-}
-
-PhysicalVariable operator "" _K(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("K", 1)}));
-}
-
-PhysicalVariable operator "" _K(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("K", 1)}));
-}
-
-PhysicalVariable operator "" _mmol(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("mol", 1)}));
-}
-
-PhysicalVariable operator "" _mmol(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("mol", 1)}));
-}
-
-PhysicalVariable operator "" _mol(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("mol", 1)}));
-}
-
-PhysicalVariable operator "" _mol(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("mol", 1)}));
-}
-
-PhysicalVariable operator "" _kmol(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("mol", 1)}));
-}
-
-PhysicalVariable operator "" _kmol(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("mol", 1)}));
-}
-
-PhysicalVariable operator "" _Cd(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("Cd", 1)}));
-}
-
-PhysicalVariable operator "" _Cd(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("Cd", 1)}));
-}
-
-PhysicalVariable operator "" _rad(long double a)
-{
-    return PhysicalVariable(a, Unit({}));
-}
-
-PhysicalVariable operator "" _rad(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({}));
-}
-
-PhysicalVariable operator "" _yHz(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _yHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _zHz(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _zHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _aHz(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _aHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _fHz(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _fHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _pHz(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _pHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _nHz(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _nHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _muHz(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _muHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _mHz(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _mHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _Hz(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _Hz(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _kHz(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _kHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _MHz(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _MHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _GHz(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _GHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _THz(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _THz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _PHz(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _PHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _EHz(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _EHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _ZHz(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _ZHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _YHz(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _YHz(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _yPa(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _yPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _zPa(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _zPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _aPa(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _aPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _fPa(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _fPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _pPa(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _pPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _nPa(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _nPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _muPa(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _muPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _mPa(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _mPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _Pa(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _Pa(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _hPa(long double a)
-{
-    return PhysicalVariable(a*1e2, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _hPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e2, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _kPa(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _kPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _MPa(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _MPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _GPa(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _GPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _TPa(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _TPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _PPa(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _PPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _EPa(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _EPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _ZPa(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _ZPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _YPa(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _YPa(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", -1), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _yJ(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _yJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _zJ(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _zJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _aJ(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _aJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _fJ(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _fJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _pJ(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _pJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _nJ(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _nJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _muJ(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _muJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _mJ(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _mJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _J(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _J(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _kJ(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _kJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _MJ(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _MJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _GJ(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _GJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _TJ(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _TJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _PJ(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _PJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _EJ(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _EJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _ZJ(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _ZJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _YJ(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _YJ(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2)}));
-}
-
-PhysicalVariable operator "" _yW(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _yW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _zW(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _zW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _aW(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _aW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _fW(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _fW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _pW(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _pW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _nW(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _nW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _muW(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _muW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _mW(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _mW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _W(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _W(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _kW(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _kW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _MW(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _MW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _GW(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _GW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _TW(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _TW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _PW(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _PW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _EW(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _EW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _ZW(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _ZW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _YW(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _YW(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3)}));
-}
-
-PhysicalVariable operator "" _mC(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("A", 1), BasicUnit("s", 1)}));
-}
-
-PhysicalVariable operator "" _mC(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("A", 1), BasicUnit("s", 1)}));
-}
-
-PhysicalVariable operator "" _C(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("A", 1), BasicUnit("s", 1)}));
-}
-
-PhysicalVariable operator "" _C(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("A", 1), BasicUnit("s", 1)}));
-}
-
-PhysicalVariable operator "" _kC(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("A", 1), BasicUnit("s", 1)}));
-}
-
-PhysicalVariable operator "" _kC(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("A", 1), BasicUnit("s", 1)}));
-}
-
-PhysicalVariable operator "" _yV(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _yV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _zV(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _zV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _aV(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _aV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _fV(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _fV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _pV(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _pV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _nV(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _nV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _muV(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _muV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _mV(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _mV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _V(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _V(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _kV(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _kV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _MV(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _MV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _GV(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _GV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _TV(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _TV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _PV(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _PV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _EV(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _EV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _ZV(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _ZV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _YV(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _YV(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _yF(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _yF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _zF(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _zF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _aF(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _aF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _fF(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _fF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _pF(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _pF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _nF(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _nF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _muF(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _muF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _mF(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _mF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _F(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _F(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _kF(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _kF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _MF(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _MF(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 4), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _yohm(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _yohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _zohm(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _zohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _aohm(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _aohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _fohm(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _fohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _pohm(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _pohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _nohm(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _nohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _muohm(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _muohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _mohm(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _mohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _ohm(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _ohm(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _kohm(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _kohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Mohm(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Mohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Gohm(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Gohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Tohm(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Tohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Pohm(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Pohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Eohm(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Eohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Zohm(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Zohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Yohm(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _Yohm(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -3), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _S(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 3), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _S(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", -2), BasicUnit("kg", -1), BasicUnit("s", 3), BasicUnit("A", 2)}));
-}
-
-PhysicalVariable operator "" _Wb(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _Wb(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _yT(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _yT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _zT(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _zT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _aT(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _aT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _fT(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _fT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _pT(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _pT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _nT(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _nT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _muT(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _muT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _mT(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _mT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _T(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _T(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _kT(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _kT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _MT(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _MT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _GT(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _GT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _TT(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _TT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _PT(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _PT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _ET(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _ET(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _ZT(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _ZT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _YT(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _YT(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -1)}));
-}
-
-PhysicalVariable operator "" _yH(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _yH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _zH(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _zH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _aH(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _aH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _fH(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _fH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _pH(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _pH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _nH(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _nH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _muH(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _muH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _mH(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _mH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _H(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _H(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _kH(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _kH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _MH(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _MH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _GH(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _GH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _TH(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _TH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _PH(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _PH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _EH(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _EH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _ZH(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _ZH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _YH(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _YH(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("m", 2), BasicUnit("kg", 1), BasicUnit("s", -2), BasicUnit("A", -2)}));
-}
-
-PhysicalVariable operator "" _degC(long double a)
-{
-    return PhysicalVariable(a-273.15, Unit({BasicUnit("K", 1)}));
-}
-
-PhysicalVariable operator "" _degC(unsigned long long int a)
-{
-    return PhysicalVariable(a-273.15, Unit({BasicUnit("K", 1)}));
-}
-
-PhysicalVariable operator "" _yBc(long double a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _yBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-24, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _zBc(long double a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _zBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-21, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _aBc(long double a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _aBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-18, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _fBc(long double a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _fBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-15, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _pBc(long double a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _pBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-12, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _nBc(long double a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _nBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-9, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _muBc(long double a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _muBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-6, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _mBc(long double a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _mBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e-3, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _Bc(long double a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _Bc(unsigned long long int a)
-{
-    return PhysicalVariable(a, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _kBc(long double a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _kBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e3, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _MBc(long double a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _MBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e6, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _GBc(long double a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _GBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e9, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _TBc(long double a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _TBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e12, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _PBc(long double a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _PBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e15, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _EBc(long double a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _EBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e18, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _ZBc(long double a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _ZBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e21, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _YBc(long double a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("s", -1)}));
-}
-
-PhysicalVariable operator "" _YBc(unsigned long long int a)
-{
-    return PhysicalVariable(a*1e24, Unit({BasicUnit("s", -1)}));
+    if(!Unit::checked)
+        return appendNumber(first, last, pv.getValue(), format);
+    const std::string& symbol = pv.getUnit().displaySymbol();
+    PrefixedValue prefixed;
+    if(format.prefix && withSiPrefix(pv.getValue(), symbol, format, prefixed))
+    {
+        char* out = append(appendNumber(first, last, prefixed.value, format), last, " ", 1);
+        out = append(out, last, prefixed.prefix, std::strlen(prefixed.prefix));
+        return append(out, last, symbol.data() + prefixed.skip, symbol.size() - prefixed.skip);
+    }
+    char* out = append(appendNumber(first, last, pv.getValue(), format), last, " ", 1);
+    return append(out, last, symbol.data(), symbol.size());
 }
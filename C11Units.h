@@ -4,9 +4,17 @@
 #include <iostream>
 #include <exception>
 #include <set>
-#include <map>
+#include <unordered_map>
 #include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
 #include <cmath>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
 
 class UnitErrorException: public std::exception
 {
@@ -16,33 +24,287 @@ class UnitErrorException: public std::exception
     }
 } const unitErrorException;
 
+/// Thrown by the text parsers for malformed input. position() is the offset
+/// of the offending character.
+class UnitParseError: public std::exception
+{
+public:
+    UnitParseError(const char* message, std::size_t position) : message(message), offset(position) {}
+
+    virtual const char* what() const throw()
+    {
+        return message;
+    }
+
+    std::size_t position() const
+    {
+        return offset;
+    }
+
+private:
+    const char* message;
+    std::size_t offset;
+};
+
+enum UnitStatus : unsigned char { unitOk, unitMismatch, unitNonIntegralRoot, unitExponentOverflow };
+
+/// Decides per thread what a failed unit check does. By default it throws
+/// unitErrorException. With poisonWithNaN nothing is thrown: the affected
+/// PhysicalVariable becomes a quiet NaN and the first error is kept in
+/// status() and operation() until clear() is called.
+class UnitErrorPolicy
+{
+public:
+    enum Mode { throwException, poisonWithNaN };
+
+    static void setMode(Mode m);
+    static Mode mode();
+    static UnitStatus status();
+    static const char* operation();
+    static void clear();
+    static void report(UnitStatus s, const char* operation);
+};
+
+/// Base unit symbols are interned into a global table, so a BasicUnit only
+/// holds a small integer id. The SI base units have fixed ids in alphabetical
+/// order; further symbols get the remaining ids when they are first used.
 class BasicUnit
 {
 public:
-    std::string unit;
+    enum Symbol : unsigned char { A, Cd, K, kg, m, mol, s };
+    static const unsigned capacity = 8;
+
+    unsigned char id;
     signed exp;
 
+    constexpr BasicUnit(Symbol symbol, signed i) : id(symbol), exp(i) {}
     BasicUnit(std::string s, signed i);
+    const char* symbol() const;
     bool operator<(BasicUnit a) const;
     bool operator==(BasicUnit a) const;
+
+    static unsigned char intern(const std::string& symbol);
+    static const char* symbol(unsigned char id);
 };
 
+class PhysicalVariable;
+
+/// A Unit stores the exponents of the base units packed as signed bytes
+/// into a single 64 bit word, one lane per BasicUnit id. Unit arithmetic
+/// therefore never allocates and can be evaluated at compile time.
+/// Every distinct unit has exactly one representation, so a Unit is its own
+/// canonical handle: copying it is copying a word and comparing two units is
+/// a single integer compare.
 class Unit
 {
 public:
+    static const unsigned lanes = BasicUnit::capacity;
+
+    /// Defining C11UNITS_UNCHECKED turns off all dimension checks and makes
+    /// PhysicalVariable a plain double. Code stays source compatible, but
+    /// values print without their unit.
+#ifndef C11UNITS_UNCHECKED
+    static constexpr bool checked = true;
+#else
+    static constexpr bool checked = false;
+#endif
+
     Unit(std::set<BasicUnit> u);
 
-    Unit operator+(Unit u) const;
-    Unit operator*(Unit u) const;
-    Unit reciprocal() const;
-    Unit pow(signed exponent) const;
+    /// Rebuilds a unit from its signature().
+    constexpr explicit Unit(std::uint64_t signature) : exponents(signature) {}
+
+    /// Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2) is kg m / s^2.
+    template<typename... More>
+    constexpr Unit(BasicUnit::Symbol symbol, signed exp, More... more) : exponents(packed(symbol, exp, more...)) {}
+
+    constexpr bool compatible(Unit u) const
+    {
+        return !checked || exponents == u.exponents;
+    }
+
+    constexpr bool canMultiply(Unit u) const
+    {
+        return !sumOverflows(exponents, u.exponents);
+    }
+
+    constexpr bool canDivide(Unit u) const
+    {
+        return !differenceOverflows(exponents, u.exponents);
+    }
+
+    constexpr Unit operator+(Unit u) const
+    {
+        return compatible(u) ? *this : (UnitErrorPolicy::report(unitMismatch, "+"), *this);
+    }
+
+    constexpr Unit operator*(Unit u) const
+    {
+        return Unit(checkedSum(exponents, u.exponents, "*"));
+    }
+
+    /// Same as *this * u.reciprocal(), but in a single lane-wise subtraction.
+    constexpr Unit operator/(Unit u) const
+    {
+        return Unit(checkedDifference(exponents, u.exponents, "/"));
+    }
+
+    Unit& operator*=(Unit u)
+    {
+        exponents = checkedSum(exponents, u.exponents, "*");
+        return *this;
+    }
+
+    Unit& operator/=(Unit u)
+    {
+        exponents = checkedDifference(exponents, u.exponents, "/");
+        return *this;
+    }
+
+    constexpr Unit reciprocal() const
+    {
+        return Unit(checkedDifference(0, exponents, "reciprocal"));
+    }
+
+    constexpr bool canPow(signed exponent) const
+    {
+        return !powerOverflows(exponents, exponent, 0);
+    }
+
+    constexpr Unit pow(signed exponent) const
+    {
+        return Unit(powerOverflows(exponents, exponent, 0)
+            ? (UnitErrorPolicy::report(unitExponentOverflow, "pow"), power(exponents, exponent, 0))
+            : power(exponents, exponent, 0));
+    }
+
+    UnitStatus tryPow(signed exponent, Unit& result) const
+    {
+        if(!canPow(exponent))
+            return unitExponentOverflow;
+        result = pow(exponent);
+        return unitOk;
+    }
+
+    /// root results are memoized per thread, including the failing checks.
+    /// CacheStatistics counts lookups of the calling thread.
+    struct CacheStatistics
+    {
+        std::uint64_t hits;
+        std::uint64_t misses;
+    };
+
     Unit root(signed exponent) const;
+    UnitStatus tryRoot(signed exponent, Unit& result) const;
+    static CacheStatistics cacheStatistics();
+    static void resetCacheStatistics();
+
+    constexpr bool operator==(Unit u) const
+    {
+        return exponents == u.exponents;
+    }
+
+    constexpr bool operator!=(Unit u) const
+    {
+        return exponents != u.exponents;
+    }
+
+    constexpr signed exponent(unsigned lane) const
+    {
+        return exponentOf(exponents, lane);
+    }
+
+    /// The packed exponents already identify a unit uniquely, so they double
+    /// as its hash. Two units are equal exactly if their signatures are equal.
+    constexpr std::uint64_t signature() const
+    {
+        return exponents;
+    }
+
     std::string hash() const;
+    /// The text operator<< prints without the trailing space, e.g. "Hz" or
+    /// "kg / s^3". It is rendered once per unit and shared by all threads,
+    /// so the reference stays valid until the program ends.
+    const std::string& displaySymbol() const;
     friend std::ostream& operator<< (std::ostream& out, const Unit& u);
+    friend Unit parseUnit(const char* text, std::size_t length);
+    friend std::ostream& operator<< (std::ostream& out, const PhysicalVariable& pv);
 
 private:
-    std::set<BasicUnit> units;
-    static const std::map<std::string, std::string> mappedUnits;
+    static constexpr std::uint64_t lowBits = 0x7F7F7F7F7F7F7F7FULL;
+    static constexpr std::uint64_t highBits = 0x8080808080808080ULL;
+
+    static constexpr signed exponentOf(std::uint64_t e, unsigned lane)
+    {
+        return static_cast<signed>((e >> (8 * lane)) & 0xFF) - ((e >> (8 * lane)) & 0x80 ? 256 : 0);
+    }
+
+    /// Lane-wise multiplication of the exponents by n, starting at lane.
+    static constexpr std::uint64_t power(std::uint64_t e, signed n, unsigned lane)
+    {
+        return lane == lanes ? 0 : (static_cast<std::uint64_t>(exponentOf(e, lane) * static_cast<long long>(n)) & 0xFF) << (8 * lane) | power(e, n, lane + 1);
+    }
+
+    static constexpr bool powerOverflows(std::uint64_t e, signed n, unsigned lane)
+    {
+        return checked && lane != lanes
+            && (exponentOf(e, lane) * static_cast<long long>(n) < -128 || exponentOf(e, lane) * static_cast<long long>(n) > 127 || powerOverflows(e, n, lane + 1));
+    }
+
+    static constexpr std::uint64_t pack(unsigned lane, signed exp)
+    {
+        return checked && (exp < -128 || exp > 127)
+            ? (UnitErrorPolicy::report(unitExponentOverflow, "Unit"), std::uint64_t(0))
+            : (static_cast<std::uint64_t>(exp) & 0xFF) << (8 * lane);
+    }
+
+    static constexpr std::uint64_t packed()
+    {
+        return 0;
+    }
+
+    template<typename... More>
+    static constexpr std::uint64_t packed(BasicUnit::Symbol symbol, signed exp, More... more)
+    {
+        return checkedSum(pack(symbol, exp), packed(more...), "Unit");
+    }
+
+    /// Lane-wise addition of the exponents. The high bit of every lane is
+    /// added separately so that no carry crosses into the neighbouring lane.
+    static constexpr std::uint64_t sum(std::uint64_t a, std::uint64_t b)
+    {
+        return ((a & lowBits) + (b & lowBits)) ^ ((a ^ b) & highBits);
+    }
+
+    static constexpr bool sumOverflows(std::uint64_t a, std::uint64_t b)
+    {
+        return checked && (~(a ^ b) & (a ^ sum(a, b)) & highBits) != 0;
+    }
+
+    /// Lane-wise subtraction. The high bit of every lane of a is set first so
+    /// that no borrow crosses into the neighbouring lane, then corrected.
+    static constexpr std::uint64_t difference(std::uint64_t a, std::uint64_t b)
+    {
+        return ((a | highBits) - (b & lowBits)) ^ ((a ^ ~b) & highBits);
+    }
+
+    static constexpr bool differenceOverflows(std::uint64_t a, std::uint64_t b)
+    {
+        return checked && ((a ^ b) & (a ^ difference(a, b)) & highBits) != 0;
+    }
+
+    static constexpr std::uint64_t checkedSum(std::uint64_t a, std::uint64_t b, const char* operation)
+    {
+        return sumOverflows(a, b) ? (UnitErrorPolicy::report(unitExponentOverflow, operation), sum(a, b)) : sum(a, b);
+    }
+
+    static constexpr std::uint64_t checkedDifference(std::uint64_t a, std::uint64_t b, const char* operation)
+    {
+        return differenceOverflows(a, b) ? (UnitErrorPolicy::report(unitExponentOverflow, operation), difference(a, b)) : difference(a, b);
+    }
+
+    std::uint64_t exponents;
+    static const std::unordered_map<std::uint64_t, std::string> mappedUnits;
 };
 
 std::ostream& operator<< (std::ostream& out, const Unit& u);
@@ -50,596 +312,586 @@ std::ostream& operator<< (std::ostream& out, const Unit& u);
 class PhysicalVariable
 {
 public:
-    PhysicalVariable(double v, Unit u);
-
-    PhysicalVariable operator+(const PhysicalVariable v) const;
-    PhysicalVariable operator-(const PhysicalVariable v) const;
-    PhysicalVariable operator/(const PhysicalVariable v) const;
-    PhysicalVariable operator*(const PhysicalVariable v) const;
-    PhysicalVariable operator*(const double v) const;
-    PhysicalVariable operator/(const double v) const;
-    PhysicalVariable operator+(const double v) const;
-    PhysicalVariable operator-(const double v) const;
-    PhysicalVariable operator^(const signed v) const;
-    PhysicalVariable pow(const signed v) const;
+#ifndef C11UNITS_UNCHECKED
+    constexpr PhysicalVariable(double v, Unit u) : value(v), unit(u) {}
+#else
+    constexpr PhysicalVariable(double v, Unit) : value(v) {}
+#endif
+
+    constexpr double getValue() const
+    {
+        return value;
+    }
+
+    /// Always dimensionless if C11UNITS_UNCHECKED is defined.
+    constexpr Unit getUnit() const
+    {
+#ifndef C11UNITS_UNCHECKED
+        return unit;
+#else
+        return Unit({});
+#endif
+    }
+
+    constexpr PhysicalVariable operator+(const PhysicalVariable v) const
+    {
+        return getUnit().compatible(v.getUnit()) ? PhysicalVariable(value + v.value, getUnit()) : poisoned(unitMismatch, "+");
+    }
+
+    constexpr PhysicalVariable operator-(const PhysicalVariable v) const
+    {
+        return getUnit().compatible(v.getUnit()) ? PhysicalVariable(value - v.value, getUnit()) : poisoned(unitMismatch, "-");
+    }
+
+    constexpr PhysicalVariable operator/(const PhysicalVariable v) const
+    {
+        return getUnit().canDivide(v.getUnit()) ? PhysicalVariable(value / v.value, getUnit() / v.getUnit()) : poisoned(unitExponentOverflow, "/");
+    }
+
+    constexpr PhysicalVariable operator*(const PhysicalVariable v) const
+    {
+        return getUnit().canMultiply(v.getUnit()) ? PhysicalVariable(value * v.value, getUnit() * v.getUnit()) : poisoned(unitExponentOverflow, "*");
+    }
+
+    constexpr PhysicalVariable operator*(const double v) const
+    {
+        return PhysicalVariable(value * v, getUnit());
+    }
+
+    constexpr PhysicalVariable operator/(const double v) const
+    {
+        return PhysicalVariable(value / v, getUnit());
+    }
+
+    constexpr PhysicalVariable operator+(const double v) const
+    {
+        return getUnit().compatible(Unit({})) ? PhysicalVariable(value + v, getUnit()) : poisoned(unitMismatch, "+");
+    }
+
+    constexpr PhysicalVariable operator-(const double v) const
+    {
+        return getUnit().compatible(Unit({})) ? PhysicalVariable(value - v, getUnit()) : poisoned(unitMismatch, "-");
+    }
+
+    PhysicalVariable& operator+=(const PhysicalVariable v)
+    {
+        return *this = *this + v;
+    }
+
+    PhysicalVariable& operator-=(const PhysicalVariable v)
+    {
+        return *this = *this - v;
+    }
+
+    PhysicalVariable& operator*=(const PhysicalVariable v)
+    {
+        return *this = *this * v;
+    }
+
+    PhysicalVariable& operator/=(const PhysicalVariable v)
+    {
+        return *this = *this / v;
+    }
+
+    PhysicalVariable& operator*=(const double v)
+    {
+        value *= v;
+        return *this;
+    }
+
+    PhysicalVariable& operator/=(const double v)
+    {
+        value /= v;
+        return *this;
+    }
+
+    /// Changes only the unit, the value is kept: (3_m^2) is 3 m^2. Use pow()
+    /// to raise the value too, which is what x^2 means in CompiledFormula.
+    constexpr PhysicalVariable operator^(const signed v) const
+    {
+        return getUnit().canPow(v) ? PhysicalVariable(value, getUnit().pow(v)) : poisoned(unitExponentOverflow, "^");
+    }
+
+    PhysicalVariable pow(const signed v) const
+    {
+        return getUnit().canPow(v) ? PhysicalVariable(std::pow(value, v), getUnit().pow(v)) : poisoned(unitExponentOverflow, "pow");
+    }
+
     PhysicalVariable root(const signed v) const;
+
+    /// Non-throwing variants. On success they store the result and return
+    /// unitOk, otherwise result is left untouched.
+    UnitStatus tryAdd(const PhysicalVariable v, PhysicalVariable& result) const
+    {
+        if(!getUnit().compatible(v.getUnit()))
+            return unitMismatch;
+        result = PhysicalVariable(value + v.value, getUnit());
+        return unitOk;
+    }
+
+    UnitStatus trySubtract(const PhysicalVariable v, PhysicalVariable& result) const
+    {
+        if(!getUnit().compatible(v.getUnit()))
+            return unitMismatch;
+        result = PhysicalVariable(value - v.value, getUnit());
+        return unitOk;
+    }
+
+    UnitStatus tryMultiply(const PhysicalVariable v, PhysicalVariable& result) const
+    {
+        if(!getUnit().canMultiply(v.getUnit()))
+            return unitExponentOverflow;
+        result = PhysicalVariable(value * v.value, getUnit() * v.getUnit());
+        return unitOk;
+    }
+
+    UnitStatus tryDivide(const PhysicalVariable v, PhysicalVariable& result) const
+    {
+        if(!getUnit().canDivide(v.getUnit()))
+            return unitExponentOverflow;
+        result = PhysicalVariable(value / v.value, getUnit() / v.getUnit());
+        return unitOk;
+    }
+
+    UnitStatus tryPow(const signed v, PhysicalVariable& result) const
+    {
+        if(!getUnit().canPow(v))
+            return unitExponentOverflow;
+        result = PhysicalVariable(std::pow(value, v), getUnit().pow(v));
+        return unitOk;
+    }
+
+    UnitStatus tryRoot(const signed v, PhysicalVariable& result) const;
     friend std::ostream& operator<< (std::ostream& out, const PhysicalVariable& pv);
 
 private:
+    /// Reports the error to the UnitErrorPolicy and returns a NaN if it
+    /// does not throw.
+    static PhysicalVariable poisoned(UnitStatus status, const char* operation);
+
     double value;
+#ifndef C11UNITS_UNCHECKED
     Unit unit;
+#endif
 };
 
+/// Scalars on the left, so generic code can treat doubles and
+/// PhysicalVariables alike.
+constexpr PhysicalVariable operator*(const double v, const PhysicalVariable pv)
+{
+    return pv * v;
+}
+
+constexpr PhysicalVariable operator/(const double v, const PhysicalVariable pv)
+{
+    return PhysicalVariable(v, Unit({})) / pv;
+}
+
 std::ostream& operator<< (std::ostream& out, const PhysicalVariable& pv);
 
-PhysicalVariable operator "" _pc(long double a);
-PhysicalVariable operator "" _pc(unsigned long long int a);
-
-PhysicalVariable operator "" _ly(long double a);
-PhysicalVariable operator "" _ly(unsigned long long int a);
-
-PhysicalVariable operator "" _km(long double a);
-PhysicalVariable operator "" _km(unsigned long long int a);
-PhysicalVariable operator "" _m(long double a);
-PhysicalVariable operator "" _m(unsigned long long int a);
-PhysicalVariable operator "" _dm(long double a);
-PhysicalVariable operator "" _dm(unsigned long long int a);
-PhysicalVariable operator "" _cm(long double a);
-PhysicalVariable operator "" _cm(unsigned long long int a);
-PhysicalVariable operator "" _mm(long double a);
-PhysicalVariable operator "" _mm(unsigned long long int a);
-PhysicalVariable operator "" _mum(long double a);
-PhysicalVariable operator "" _mum(unsigned long long int a);
-PhysicalVariable operator "" _nm(long double a);
-PhysicalVariable operator "" _nm(unsigned long long int a);
-PhysicalVariable operator "" _pm(long double a);
-PhysicalVariable operator "" _pm(unsigned long long int a);
-PhysicalVariable operator "" _fm(long double a);
-PhysicalVariable operator "" _fm(unsigned long long int a);
-PhysicalVariable operator "" _am(long double a);
-PhysicalVariable operator "" _am(unsigned long long int a);
-PhysicalVariable operator "" _zm(long double a);
-PhysicalVariable operator "" _zm(unsigned long long int a);
-PhysicalVariable operator "" _ym(long double a);
-PhysicalVariable operator "" _ym(unsigned long long int a);
-
-PhysicalVariable operator "" _a(long double a);
-PhysicalVariable operator "" _a(unsigned long long int a);
-PhysicalVariable operator "" _d(long double a);
-PhysicalVariable operator "" _d(unsigned long long int a);
-PhysicalVariable operator "" _h(long double a);
-PhysicalVariable operator "" _h(unsigned long long int a);
-PhysicalVariable operator "" _min(long double a);
-PhysicalVariable operator "" _min(unsigned long long int a);
-PhysicalVariable operator "" _s(long double a);
-PhysicalVariable operator "" _s(unsigned long long int a);
-PhysicalVariable operator "" _ms(long double a);
-PhysicalVariable operator "" _ms(unsigned long long int a);
-PhysicalVariable operator "" _mus(long double a);
-PhysicalVariable operator "" _mus(unsigned long long int a);
-PhysicalVariable operator "" _ns(long double a);
-PhysicalVariable operator "" _ns(unsigned long long int a);
-PhysicalVariable operator "" _ps(long double a);
-PhysicalVariable operator "" _ps(unsigned long long int a);
-PhysicalVariable operator "" _fs(long double a);
-PhysicalVariable operator "" _fs(unsigned long long int a);
-PhysicalVariable operator "" _as(long double a);
-PhysicalVariable operator "" _as(unsigned long long int a);
-PhysicalVariable operator "" _zs(long double a);
-PhysicalVariable operator "" _zs(unsigned long long int a);
-PhysicalVariable operator "" _ys(long double a);
-PhysicalVariable operator "" _ys(unsigned long long int a);
-
-PhysicalVariable operator "" _kg(long double a);
-PhysicalVariable operator "" _kg(unsigned long long int a);
-PhysicalVariable operator "" _g(unsigned long long int a);
-PhysicalVariable operator "" _g(long double a);
-PhysicalVariable operator "" _mg(unsigned long long int a);
-PhysicalVariable operator "" _mg(long double a);
-PhysicalVariable operator "" _mug(unsigned long long int a);
-PhysicalVariable operator "" _mug(long double a);
-PhysicalVariable operator "" _ng(unsigned long long int a);
-PhysicalVariable operator "" _ng(long double a);
-PhysicalVariable operator "" _pg(unsigned long long int a);
-PhysicalVariable operator "" _pg(long double a);
-PhysicalVariable operator "" _fg(unsigned long long int a);
-PhysicalVariable operator "" _fg(long double a);
-PhysicalVariable operator "" _ag(unsigned long long int a);
-PhysicalVariable operator "" _ag(long double a);
-PhysicalVariable operator "" _zg(unsigned long long int a);
-PhysicalVariable operator "" _zg(long double a);
-PhysicalVariable operator "" _yg(unsigned long long int a);
-PhysicalVariable operator "" _yg(long double a);
-
-PhysicalVariable operator "" _deg(long double a);
-PhysicalVariable operator "" _deg(unsigned long long int a);
-PhysicalVariable operator "" _degMin(long double a);
-PhysicalVariable operator "" _degMin(unsigned long long int a);
-PhysicalVariable operator "" _degSec(long double a);
-PhysicalVariable operator "" _degSec(unsigned long long int a);
-
-PhysicalVariable operator "" _kl(long double a);
-PhysicalVariable operator "" _kl(unsigned long long int a);
-PhysicalVariable operator "" _hl(long double a);
-PhysicalVariable operator "" _hl(unsigned long long int a);
-PhysicalVariable operator "" _l(long double a);
-PhysicalVariable operator "" _l(unsigned long long int a);
-PhysicalVariable operator "" _ml(long double a);
-PhysicalVariable operator "" _ml(unsigned long long int a);
-PhysicalVariable operator "" _mul(long double a);
-PhysicalVariable operator "" _mul(unsigned long long int a);
-PhysicalVariable operator "" _nl(long double a);
-PhysicalVariable operator "" _nl(unsigned long long int a);
-
-PhysicalVariable operator "" _t(long double a);
-PhysicalVariable operator "" _t(unsigned long long int a);
-
-PhysicalVariable operator "" _meV(long double a);
-PhysicalVariable operator "" _meV(unsigned long long int a);
-PhysicalVariable operator "" _eV(long double a);
-PhysicalVariable operator "" _eV(unsigned long long int a);
-PhysicalVariable operator "" _keV(long double a);
-PhysicalVariable operator "" _keV(unsigned long long int a);
-PhysicalVariable operator "" _MeV(long double a);
-PhysicalVariable operator "" _MeV(unsigned long long int a);
-PhysicalVariable operator "" _GeV(long double a);
-PhysicalVariable operator "" _GeV(unsigned long long int a);
-PhysicalVariable operator "" _TeV(long double a);
-PhysicalVariable operator "" _TeV(unsigned long long int a);
-PhysicalVariable operator "" _PeV(long double a);
-PhysicalVariable operator "" _PeV(unsigned long long int a);
-PhysicalVariable operator "" _EeV(long double a);
-PhysicalVariable operator "" _EeV(unsigned long long int a);
-PhysicalVariable operator "" _ZeV(long double a);
-PhysicalVariable operator "" _ZeV(unsigned long long int a);
-PhysicalVariable operator "" _YeV(long double a);
-PhysicalVariable operator "" _YeV(unsigned long long int a);
-
-PhysicalVariable operator "" _u(long double a);
-PhysicalVariable operator "" _u(unsigned long long int a);
-
-PhysicalVariable operator "" _yN(long double a);
-PhysicalVariable operator "" _yN(unsigned long long int a);
-PhysicalVariable operator "" _zN(long double a);
-PhysicalVariable operator "" _zN(unsigned long long int a);
-PhysicalVariable operator "" _aN(long double a);
-PhysicalVariable operator "" _aN(unsigned long long int a);
-PhysicalVariable operator "" _fN(long double a);
-PhysicalVariable operator "" _fN(unsigned long long int a);
-PhysicalVariable operator "" _pN(long double a);
-PhysicalVariable operator "" _pN(unsigned long long int a);
-PhysicalVariable operator "" _nN(long double a);
-PhysicalVariable operator "" _nN(unsigned long long int a);
-PhysicalVariable operator "" _muN(long double a);
-PhysicalVariable operator "" _muN(unsigned long long int a);
-PhysicalVariable operator "" _mN(long double a);
-PhysicalVariable operator "" _mN(unsigned long long int a);
-PhysicalVariable operator "" _N(long double a);
-PhysicalVariable operator "" _N(unsigned long long int a);
-PhysicalVariable operator "" _kN(long double a);
-PhysicalVariable operator "" _kN(unsigned long long int a);
-PhysicalVariable operator "" _MN(long double a);
-PhysicalVariable operator "" _MN(unsigned long long int a);
-PhysicalVariable operator "" _GN(long double a);
-PhysicalVariable operator "" _GN(unsigned long long int a);
-PhysicalVariable operator "" _TN(long double a);
-PhysicalVariable operator "" _TN(unsigned long long int a);
-PhysicalVariable operator "" _PN(long double a);
-PhysicalVariable operator "" _PN(unsigned long long int a);
-PhysicalVariable operator "" _EN(long double a);
-PhysicalVariable operator "" _EN(unsigned long long int a);
-PhysicalVariable operator "" _ZN(long double a);
-PhysicalVariable operator "" _ZN(unsigned long long int a);
-PhysicalVariable operator "" _YN(long double a);
-PhysicalVariable operator "" _YN(unsigned long long int a);
-
-PhysicalVariable operator "" _yA(long double a);
-PhysicalVariable operator "" _yA(unsigned long long int a);
-PhysicalVariable operator "" _zA(long double a);
-PhysicalVariable operator "" _zA(unsigned long long int a);
-PhysicalVariable operator "" _aA(long double a);
-PhysicalVariable operator "" _aA(unsigned long long int a);
-PhysicalVariable operator "" _fA(long double a);
-PhysicalVariable operator "" _fA(unsigned long long int a);
-PhysicalVariable operator "" _pA(long double a);
-PhysicalVariable operator "" _pA(unsigned long long int a);
-PhysicalVariable operator "" _nA(long double a);
-PhysicalVariable operator "" _nA(unsigned long long int a);
-PhysicalVariable operator "" _muA(long double a);
-PhysicalVariable operator "" _muA(unsigned long long int a);
-PhysicalVariable operator "" _mA(long double a);
-PhysicalVariable operator "" _mA(unsigned long long int a);
-PhysicalVariable operator "" _A(long double a);
-PhysicalVariable operator "" _A(unsigned long long int a);
-PhysicalVariable operator "" _kA(long double a);
-PhysicalVariable operator "" _kA(unsigned long long int a);
-PhysicalVariable operator "" _MA(long double a);
-PhysicalVariable operator "" _MA(unsigned long long int a);
-PhysicalVariable operator "" _GA(long double a);
-PhysicalVariable operator "" _GA(unsigned long long int a);
-PhysicalVariable operator "" _TA(long double a);
-PhysicalVariable operator "" _TA(unsigned long long int a);
-PhysicalVariable operator "" _PA(long double a);
-PhysicalVariable operator "" _PA(unsigned long long int a);
-PhysicalVariable operator "" _EA(long double a);
-PhysicalVariable operator "" _EA(unsigned long long int a);
-PhysicalVariable operator "" _ZA(long double a);
-PhysicalVariable operator "" _ZA(unsigned long long int a);
-PhysicalVariable operator "" _YA(long double a);
-PhysicalVariable operator "" _YA(unsigned long long int a);
-
-PhysicalVariable operator "" _K(long double a);
-PhysicalVariable operator "" _K(unsigned long long int a);
-
-PhysicalVariable operator "" _mmol(long double a);
-PhysicalVariable operator "" _mmol(unsigned long long int a);
-PhysicalVariable operator "" _mol(long double a);
-PhysicalVariable operator "" _mol(unsigned long long int a);
-PhysicalVariable operator "" _kmol(long double a);
-PhysicalVariable operator "" _kmol(unsigned long long int a);
-
-PhysicalVariable operator "" _Cd(long double a);
-PhysicalVariable operator "" _Cd(unsigned long long int a);
-
-PhysicalVariable operator "" _rad(long double a);
-PhysicalVariable operator "" _rad(unsigned long long int a);
-
-PhysicalVariable operator "" _yHz(long double a);
-PhysicalVariable operator "" _yHz(unsigned long long int a);
-PhysicalVariable operator "" _zHz(long double a);
-PhysicalVariable operator "" _zHz(unsigned long long int a);
-PhysicalVariable operator "" _aHz(long double a);
-PhysicalVariable operator "" _aHz(unsigned long long int a);
-PhysicalVariable operator "" _fHz(long double a);
-PhysicalVariable operator "" _fHz(unsigned long long int a);
-PhysicalVariable operator "" _pHz(long double a);
-PhysicalVariable operator "" _pHz(unsigned long long int a);
-PhysicalVariable operator "" _nHz(long double a);
-PhysicalVariable operator "" _nHz(unsigned long long int a);
-PhysicalVariable operator "" _muHz(long double a);
-PhysicalVariable operator "" _muHz(unsigned long long int a);
-PhysicalVariable operator "" _mHz(long double a);
-PhysicalVariable operator "" _mHz(unsigned long long int a);
-PhysicalVariable operator "" _Hz(long double a);
-PhysicalVariable operator "" _Hz(unsigned long long int a);
-PhysicalVariable operator "" _kHz(long double a);
-PhysicalVariable operator "" _kHz(unsigned long long int a);
-PhysicalVariable operator "" _MHz(long double a);
-PhysicalVariable operator "" _MHz(unsigned long long int a);
-PhysicalVariable operator "" _GHz(long double a);
-PhysicalVariable operator "" _GHz(unsigned long long int a);
-PhysicalVariable operator "" _THz(long double a);
-PhysicalVariable operator "" _THz(unsigned long long int a);
-PhysicalVariable operator "" _PHz(long double a);
-PhysicalVariable operator "" _PHz(unsigned long long int a);
-PhysicalVariable operator "" _EHz(long double a);
-PhysicalVariable operator "" _EHz(unsigned long long int a);
-PhysicalVariable operator "" _ZHz(long double a);
-PhysicalVariable operator "" _ZHz(unsigned long long int a);
-PhysicalVariable operator "" _YHz(long double a);
-PhysicalVariable operator "" _YHz(unsigned long long int a);
-
-PhysicalVariable operator "" _yPa(long double a);
-PhysicalVariable operator "" _yPa(unsigned long long int a);
-PhysicalVariable operator "" _zPa(long double a);
-PhysicalVariable operator "" _zPa(unsigned long long int a);
-PhysicalVariable operator "" _aPa(long double a);
-PhysicalVariable operator "" _aPa(unsigned long long int a);
-PhysicalVariable operator "" _fPa(long double a);
-PhysicalVariable operator "" _fPa(unsigned long long int a);
-PhysicalVariable operator "" _pPa(long double a);
-PhysicalVariable operator "" _pPa(unsigned long long int a);
-PhysicalVariable operator "" _nPa(long double a);
-PhysicalVariable operator "" _nPa(unsigned long long int a);
-PhysicalVariable operator "" _muPa(long double a);
-PhysicalVariable operator "" _muPa(unsigned long long int a);
-PhysicalVariable operator "" _mPa(long double a);
-PhysicalVariable operator "" _mPa(unsigned long long int a);
-PhysicalVariable operator "" _Pa(long double a);
-PhysicalVariable operator "" _Pa(unsigned long long int a);
-PhysicalVariable operator "" _hPa(long double a);
-PhysicalVariable operator "" _hPa(unsigned long long int a);
-PhysicalVariable operator "" _kPa(long double a);
-PhysicalVariable operator "" _kPa(unsigned long long int a);
-PhysicalVariable operator "" _MPa(long double a);
-PhysicalVariable operator "" _MPa(unsigned long long int a);
-PhysicalVariable operator "" _GPa(long double a);
-PhysicalVariable operator "" _GPa(unsigned long long int a);
-PhysicalVariable operator "" _TPa(long double a);
-PhysicalVariable operator "" _TPa(unsigned long long int a);
-PhysicalVariable operator "" _PPa(long double a);
-PhysicalVariable operator "" _PPa(unsigned long long int a);
-PhysicalVariable operator "" _EPa(long double a);
-PhysicalVariable operator "" _EPa(unsigned long long int a);
-PhysicalVariable operator "" _ZPa(long double a);
-PhysicalVariable operator "" _ZPa(unsigned long long int a);
-PhysicalVariable operator "" _YPa(long double a);
-PhysicalVariable operator "" _YPa(unsigned long long int a);
-
-PhysicalVariable operator "" _yJ(long double a);
-PhysicalVariable operator "" _yJ(unsigned long long int a);
-PhysicalVariable operator "" _zJ(long double a);
-PhysicalVariable operator "" _zJ(unsigned long long int a);
-PhysicalVariable operator "" _aJ(long double a);
-PhysicalVariable operator "" _aJ(unsigned long long int a);
-PhysicalVariable operator "" _fJ(long double a);
-PhysicalVariable operator "" _fJ(unsigned long long int a);
-PhysicalVariable operator "" _pJ(long double a);
-PhysicalVariable operator "" _pJ(unsigned long long int a);
-PhysicalVariable operator "" _nJ(long double a);
-PhysicalVariable operator "" _nJ(unsigned long long int a);
-PhysicalVariable operator "" _muJ(long double a);
-PhysicalVariable operator "" _muJ(unsigned long long int a);
-PhysicalVariable operator "" _mJ(long double a);
-PhysicalVariable operator "" _mJ(unsigned long long int a);
-PhysicalVariable operator "" _J(long double a);
-PhysicalVariable operator "" _J(unsigned long long int a);
-PhysicalVariable operator "" _kJ(long double a);
-PhysicalVariable operator "" _kJ(unsigned long long int a);
-PhysicalVariable operator "" _MJ(long double a);
-PhysicalVariable operator "" _MJ(unsigned long long int a);
-PhysicalVariable operator "" _GJ(long double a);
-PhysicalVariable operator "" _GJ(unsigned long long int a);
-PhysicalVariable operator "" _TJ(long double a);
-PhysicalVariable operator "" _TJ(unsigned long long int a);
-PhysicalVariable operator "" _PJ(long double a);
-PhysicalVariable operator "" _PJ(unsigned long long int a);
-PhysicalVariable operator "" _EJ(long double a);
-PhysicalVariable operator "" _EJ(unsigned long long int a);
-PhysicalVariable operator "" _ZJ(long double a);
-PhysicalVariable operator "" _ZJ(unsigned long long int a);
-PhysicalVariable operator "" _YJ(long double a);
-PhysicalVariable operator "" _YJ(unsigned long long int a);
-
-PhysicalVariable operator "" _yW(long double a);
-PhysicalVariable operator "" _yW(unsigned long long int a);
-PhysicalVariable operator "" _zW(long double a);
-PhysicalVariable operator "" _zW(unsigned long long int a);
-PhysicalVariable operator "" _aW(long double a);
-PhysicalVariable operator "" _aW(unsigned long long int a);
-PhysicalVariable operator "" _fW(long double a);
-PhysicalVariable operator "" _fW(unsigned long long int a);
-PhysicalVariable operator "" _pW(long double a);
-PhysicalVariable operator "" _pW(unsigned long long int a);
-PhysicalVariable operator "" _nW(long double a);
-PhysicalVariable operator "" _nW(unsigned long long int a);
-PhysicalVariable operator "" _muW(long double a);
-PhysicalVariable operator "" _muW(unsigned long long int a);
-PhysicalVariable operator "" _mW(long double a);
-PhysicalVariable operator "" _mW(unsigned long long int a);
-PhysicalVariable operator "" _W(long double a);
-PhysicalVariable operator "" _W(unsigned long long int a);
-PhysicalVariable operator "" _kW(long double a);
-PhysicalVariable operator "" _kW(unsigned long long int a);
-PhysicalVariable operator "" _MW(long double a);
-PhysicalVariable operator "" _MW(unsigned long long int a);
-PhysicalVariable operator "" _GW(long double a);
-PhysicalVariable operator "" _GW(unsigned long long int a);
-PhysicalVariable operator "" _TW(long double a);
-PhysicalVariable operator "" _TW(unsigned long long int a);
-PhysicalVariable operator "" _PW(long double a);
-PhysicalVariable operator "" _PW(unsigned long long int a);
-PhysicalVariable operator "" _EW(long double a);
-PhysicalVariable operator "" _EW(unsigned long long int a);
-PhysicalVariable operator "" _ZW(long double a);
-PhysicalVariable operator "" _ZW(unsigned long long int a);
-PhysicalVariable operator "" _YW(long double a);
-PhysicalVariable operator "" _YW(unsigned long long int a);
-
-PhysicalVariable operator "" _mC(long double a);
-PhysicalVariable operator "" _mC(unsigned long long int a);
-PhysicalVariable operator "" _C(long double a);
-PhysicalVariable operator "" _C(unsigned long long int a);
-PhysicalVariable operator "" _kC(long double a);
-PhysicalVariable operator "" _kC(unsigned long long int a);
-
-PhysicalVariable operator "" _yV(long double a);
-PhysicalVariable operator "" _yV(unsigned long long int a);
-PhysicalVariable operator "" _zV(long double a);
-PhysicalVariable operator "" _zV(unsigned long long int a);
-PhysicalVariable operator "" _aV(long double a);
-PhysicalVariable operator "" _aV(unsigned long long int a);
-PhysicalVariable operator "" _fV(long double a);
-PhysicalVariable operator "" _fV(unsigned long long int a);
-PhysicalVariable operator "" _pV(long double a);
-PhysicalVariable operator "" _pV(unsigned long long int a);
-PhysicalVariable operator "" _nV(long double a);
-PhysicalVariable operator "" _nV(unsigned long long int a);
-PhysicalVariable operator "" _muV(long double a);
-PhysicalVariable operator "" _muV(unsigned long long int a);
-PhysicalVariable operator "" _mV(long double a);
-PhysicalVariable operator "" _mV(unsigned long long int a);
-PhysicalVariable operator "" _V(long double a);
-PhysicalVariable operator "" _V(unsigned long long int a);
-PhysicalVariable operator "" _kV(long double a);
-PhysicalVariable operator "" _kV(unsigned long long int a);
-PhysicalVariable operator "" _MV(long double a);
-PhysicalVariable operator "" _MV(unsigned long long int a);
-PhysicalVariable operator "" _GV(long double a);
-PhysicalVariable operator "" _GV(unsigned long long int a);
-PhysicalVariable operator "" _TV(long double a);
-PhysicalVariable operator "" _TV(unsigned long long int a);
-PhysicalVariable operator "" _PV(long double a);
-PhysicalVariable operator "" _PV(unsigned long long int a);
-PhysicalVariable operator "" _EV(long double a);
-PhysicalVariable operator "" _EV(unsigned long long int a);
-PhysicalVariable operator "" _ZV(long double a);
-PhysicalVariable operator "" _ZV(unsigned long long int a);
-PhysicalVariable operator "" _YV(long double a);
-PhysicalVariable operator "" _YV(unsigned long long int a);
-
-PhysicalVariable operator "" _yF(long double a);
-PhysicalVariable operator "" _yF(unsigned long long int a);
-PhysicalVariable operator "" _zF(long double a);
-PhysicalVariable operator "" _zF(unsigned long long int a);
-PhysicalVariable operator "" _aF(long double a);
-PhysicalVariable operator "" _aF(unsigned long long int a);
-PhysicalVariable operator "" _fF(long double a);
-PhysicalVariable operator "" _fF(unsigned long long int a);
-PhysicalVariable operator "" _pF(long double a);
-PhysicalVariable operator "" _pF(unsigned long long int a);
-PhysicalVariable operator "" _nF(long double a);
-PhysicalVariable operator "" _nF(unsigned long long int a);
-PhysicalVariable operator "" _muF(long double a);
-PhysicalVariable operator "" _muF(unsigned long long int a);
-PhysicalVariable operator "" _mF(long double a);
-PhysicalVariable operator "" _mF(unsigned long long int a);
-PhysicalVariable operator "" _F(long double a);
-PhysicalVariable operator "" _F(unsigned long long int a);
-PhysicalVariable operator "" _kF(long double a);
-PhysicalVariable operator "" _kF(unsigned long long int a);
-PhysicalVariable operator "" _MF(long double a);
-PhysicalVariable operator "" _MF(unsigned long long int a);
-
-PhysicalVariable operator "" _yohm(long double a);
-PhysicalVariable operator "" _yohm(unsigned long long int a);
-PhysicalVariable operator "" _zohm(long double a);
-PhysicalVariable operator "" _zohm(unsigned long long int a);
-PhysicalVariable operator "" _aohm(long double a);
-PhysicalVariable operator "" _aohm(unsigned long long int a);
-PhysicalVariable operator "" _fohm(long double a);
-PhysicalVariable operator "" _fohm(unsigned long long int a);
-PhysicalVariable operator "" _pohm(long double a);
-PhysicalVariable operator "" _pohm(unsigned long long int a);
-PhysicalVariable operator "" _nohm(long double a);
-PhysicalVariable operator "" _nohm(unsigned long long int a);
-PhysicalVariable operator "" _muohm(long double a);
-PhysicalVariable operator "" _muohm(unsigned long long int a);
-PhysicalVariable operator "" _mohm(long double a);
-PhysicalVariable operator "" _mohm(unsigned long long int a);
-PhysicalVariable operator "" _ohm(long double a);
-PhysicalVariable operator "" _ohm(unsigned long long int a);
-PhysicalVariable operator "" _kohm(long double a);
-PhysicalVariable operator "" _kohm(unsigned long long int a);
-PhysicalVariable operator "" _Mohm(long double a);
-PhysicalVariable operator "" _Mohm(unsigned long long int a);
-PhysicalVariable operator "" _Gohm(long double a);
-PhysicalVariable operator "" _Gohm(unsigned long long int a);
-PhysicalVariable operator "" _Tohm(long double a);
-PhysicalVariable operator "" _Tohm(unsigned long long int a);
-PhysicalVariable operator "" _Pohm(long double a);
-PhysicalVariable operator "" _Pohm(unsigned long long int a);
-PhysicalVariable operator "" _Eohm(long double a);
-PhysicalVariable operator "" _Eohm(unsigned long long int a);
-PhysicalVariable operator "" _Zohm(long double a);
-PhysicalVariable operator "" _Zohm(unsigned long long int a);
-PhysicalVariable operator "" _Yohm(long double a);
-PhysicalVariable operator "" _Yohm(unsigned long long int a);
-
-PhysicalVariable operator "" _S(long double a);
-PhysicalVariable operator "" _S(unsigned long long int a);
-
-PhysicalVariable operator "" _Wb(long double a);
-PhysicalVariable operator "" _Wb(unsigned long long int a);
-
-PhysicalVariable operator "" _yT(long double a);
-PhysicalVariable operator "" _yT(unsigned long long int a);
-PhysicalVariable operator "" _zT(long double a);
-PhysicalVariable operator "" _zT(unsigned long long int a);
-PhysicalVariable operator "" _aT(long double a);
-PhysicalVariable operator "" _aT(unsigned long long int a);
-PhysicalVariable operator "" _fT(long double a);
-PhysicalVariable operator "" _fT(unsigned long long int a);
-PhysicalVariable operator "" _pT(long double a);
-PhysicalVariable operator "" _pT(unsigned long long int a);
-PhysicalVariable operator "" _nT(long double a);
-PhysicalVariable operator "" _nT(unsigned long long int a);
-PhysicalVariable operator "" _muT(long double a);
-PhysicalVariable operator "" _muT(unsigned long long int a);
-PhysicalVariable operator "" _mT(long double a);
-PhysicalVariable operator "" _mT(unsigned long long int a);
-PhysicalVariable operator "" _T(long double a);
-PhysicalVariable operator "" _T(unsigned long long int a);
-PhysicalVariable operator "" _kT(long double a);
-PhysicalVariable operator "" _kT(unsigned long long int a);
-PhysicalVariable operator "" _MT(long double a);
-PhysicalVariable operator "" _MT(unsigned long long int a);
-PhysicalVariable operator "" _GT(long double a);
-PhysicalVariable operator "" _GT(unsigned long long int a);
-PhysicalVariable operator "" _TT(long double a);
-PhysicalVariable operator "" _TT(unsigned long long int a);
-PhysicalVariable operator "" _PT(long double a);
-PhysicalVariable operator "" _PT(unsigned long long int a);
-PhysicalVariable operator "" _ET(long double a);
-PhysicalVariable operator "" _ET(unsigned long long int a);
-PhysicalVariable operator "" _ZT(long double a);
-PhysicalVariable operator "" _ZT(unsigned long long int a);
-PhysicalVariable operator "" _YT(long double a);
-PhysicalVariable operator "" _YT(unsigned long long int a);
-
-PhysicalVariable operator "" _yH(long double a);
-PhysicalVariable operator "" _yH(unsigned long long int a);
-PhysicalVariable operator "" _zH(long double a);
-PhysicalVariable operator "" _zH(unsigned long long int a);
-PhysicalVariable operator "" _aH(long double a);
-PhysicalVariable operator "" _aH(unsigned long long int a);
-PhysicalVariable operator "" _fH(long double a);
-PhysicalVariable operator "" _fH(unsigned long long int a);
-PhysicalVariable operator "" _pH(long double a);
-PhysicalVariable operator "" _pH(unsigned long long int a);
-PhysicalVariable operator "" _nH(long double a);
-PhysicalVariable operator "" _nH(unsigned long long int a);
-PhysicalVariable operator "" _muH(long double a);
-PhysicalVariable operator "" _muH(unsigned long long int a);
-PhysicalVariable operator "" _mH(long double a);
-PhysicalVariable operator "" _mH(unsigned long long int a);
-PhysicalVariable operator "" _H(long double a);
-PhysicalVariable operator "" _H(unsigned long long int a);
-PhysicalVariable operator "" _kH(long double a);
-PhysicalVariable operator "" _kH(unsigned long long int a);
-PhysicalVariable operator "" _MH(long double a);
-PhysicalVariable operator "" _MH(unsigned long long int a);
-PhysicalVariable operator "" _GH(long double a);
-PhysicalVariable operator "" _GH(unsigned long long int a);
-PhysicalVariable operator "" _TH(long double a);
-PhysicalVariable operator "" _TH(unsigned long long int a);
-PhysicalVariable operator "" _PH(long double a);
-PhysicalVariable operator "" _PH(unsigned long long int a);
-PhysicalVariable operator "" _EH(long double a);
-PhysicalVariable operator "" _EH(unsigned long long int a);
-PhysicalVariable operator "" _ZH(long double a);
-PhysicalVariable operator "" _ZH(unsigned long long int a);
-PhysicalVariable operator "" _YH(long double a);
-PhysicalVariable operator "" _YH(unsigned long long int a);
-
-PhysicalVariable operator "" _degC(long double a);
-PhysicalVariable operator "" _degC(unsigned long long int a);
-
-PhysicalVariable operator "" _yBc(long double a);
-PhysicalVariable operator "" _yBc(unsigned long long int a);
-PhysicalVariable operator "" _zBc(long double a);
-PhysicalVariable operator "" _zBc(unsigned long long int a);
-PhysicalVariable operator "" _aBc(long double a);
-PhysicalVariable operator "" _aBc(unsigned long long int a);
-PhysicalVariable operator "" _fBc(long double a);
-PhysicalVariable operator "" _fBc(unsigned long long int a);
-PhysicalVariable operator "" _pBc(long double a);
-PhysicalVariable operator "" _pBc(unsigned long long int a);
-PhysicalVariable operator "" _nBc(long double a);
-PhysicalVariable operator "" _nBc(unsigned long long int a);
-PhysicalVariable operator "" _muBc(long double a);
-PhysicalVariable operator "" _muBc(unsigned long long int a);
-PhysicalVariable operator "" _mBc(long double a);
-PhysicalVariable operator "" _mBc(unsigned long long int a);
-PhysicalVariable operator "" _Bc(long double a);
-PhysicalVariable operator "" _Bc(unsigned long long int a);
-PhysicalVariable operator "" _kBc(long double a);
-PhysicalVariable operator "" _kBc(unsigned long long int a);
-PhysicalVariable operator "" _MBc(long double a);
-PhysicalVariable operator "" _MBc(unsigned long long int a);
-PhysicalVariable operator "" _GBc(long double a);
-PhysicalVariable operator "" _GBc(unsigned long long int a);
-PhysicalVariable operator "" _TBc(long double a);
-PhysicalVariable operator "" _TBc(unsigned long long int a);
-PhysicalVariable operator "" _PBc(long double a);
-PhysicalVariable operator "" _PBc(unsigned long long int a);
-PhysicalVariable operator "" _EBc(long double a);
-PhysicalVariable operator "" _EBc(unsigned long long int a);
-PhysicalVariable operator "" _ZBc(long double a);
-PhysicalVariable operator "" _ZBc(unsigned long long int a);
-PhysicalVariable operator "" _YBc(long double a);
-PhysicalVariable operator "" _YBc(unsigned long long int a);
-
-const auto mu_0 = (1.e-7_H / 1._m) * 4. * M_PI;
+static_assert(sizeof(Unit) == sizeof(std::uint64_t), "A Unit should be a single packed word");
+static_assert(std::is_trivially_copyable<Unit>::value, "A Unit should be trivially copyable");
+#ifndef C11UNITS_UNCHECKED
+static_assert(sizeof(PhysicalVariable) == 16, "A PhysicalVariable should be a double and a packed Unit");
+#else
+static_assert(sizeof(PhysicalVariable) == sizeof(double), "An unchecked PhysicalVariable should be a bare double");
+#endif
+static_assert(std::is_trivially_copyable<PhysicalVariable>::value, "A PhysicalVariable should be trivially copyable");
+
+/// Every unit literal as X(suffix, value of a in SI units, SI unit).
+/// To add a new unit just add a line here.
+#define C11UNITS_LITERALS(X) \
+    X(pc, a*3.0856776e16, Unit(BasicUnit::m, 1)) \
+    X(ly, a*9460730472580800, Unit(BasicUnit::m, 1)) \
+    X(km, a*1000, Unit(BasicUnit::m, 1)) \
+    X(m, a, Unit(BasicUnit::m, 1)) \
+    X(dm, a/10, Unit(BasicUnit::m, 1)) \
+    X(cm, a/100, Unit(BasicUnit::m, 1)) \
+    X(mm, a/1000, Unit(BasicUnit::m, 1)) \
+    X(mum, a*1e-6, Unit(BasicUnit::m, 1)) \
+    X(nm, a*1e-9, Unit(BasicUnit::m, 1)) \
+    X(pm, a*1e-12, Unit(BasicUnit::m, 1)) \
+    X(fm, a*1e-15, Unit(BasicUnit::m, 1)) \
+    X(am, a*1e-18, Unit(BasicUnit::m, 1)) \
+    X(zm, a*1e-21, Unit(BasicUnit::m, 1)) \
+    X(ym, a*1e-24, Unit(BasicUnit::m, 1)) \
+    X(a, a*31557600, Unit(BasicUnit::s, 1)) \
+    X(d, a*86400, Unit(BasicUnit::s, 1)) \
+    X(h, a*3600, Unit(BasicUnit::s, 1)) \
+    X(min, a*60, Unit(BasicUnit::s, 1)) \
+    X(s, a, Unit(BasicUnit::s, 1)) \
+    X(ms, a*1e-3, Unit(BasicUnit::s, 1)) \
+    X(mus, a*1e-6, Unit(BasicUnit::s, 1)) \
+    X(ns, a*1e-9, Unit(BasicUnit::s, 1)) \
+    X(ps, a*1e-12, Unit(BasicUnit::s, 1)) \
+    X(fs, a*1e-15, Unit(BasicUnit::s, 1)) \
+    X(as, a*1e-18, Unit(BasicUnit::s, 1)) \
+    X(zs, a*1e-21, Unit(BasicUnit::s, 1)) \
+    X(ys, a*1e-24, Unit(BasicUnit::s, 1)) \
+    X(kg, a, Unit(BasicUnit::kg, 1)) \
+    X(g, a/1000, Unit(BasicUnit::kg, 1)) \
+    X(mg, a*1e-6, Unit(BasicUnit::kg, 1)) \
+    X(mug, a*1e-9, Unit(BasicUnit::kg, 1)) \
+    X(ng, a*1e-12, Unit(BasicUnit::kg, 1)) \
+    X(pg, a*1e-15, Unit(BasicUnit::kg, 1)) \
+    X(fg, a*1e-18, Unit(BasicUnit::kg, 1)) \
+    X(ag, a*1e-21, Unit(BasicUnit::kg, 1)) \
+    X(zg, a*1e-24, Unit(BasicUnit::kg, 1)) \
+    X(yg, a*1e-27, Unit(BasicUnit::kg, 1)) \
+    X(deg, M_PI*a/180, Unit({})) \
+    X(degMin, M_PI*a/10800, Unit({})) \
+    X(degSec, M_PI*a/648000, Unit({})) \
+    X(kl, a*1000, Unit(BasicUnit::m, -3)) \
+    X(hl, a*100, Unit(BasicUnit::m, -3)) \
+    X(l, a/1000, Unit(BasicUnit::m, -3)) \
+    X(ml, a*1e-6, Unit(BasicUnit::m, -3)) \
+    X(mul, a*1e-9, Unit(BasicUnit::m, -3)) \
+    X(nl, a*1e-12, Unit(BasicUnit::m, -3)) \
+    X(t, a*1000, Unit(BasicUnit::kg, 1)) \
+    X(meV, a*1.602176565e-22, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(eV, a*1.602176565e-19, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(keV, a*1.602176565e-16, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(MeV, a*1.602176565e-13, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(GeV, a*1.602176565e-10, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(TeV, a*1.602176565e-7, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(PeV, a*1.602176565e-4, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(EeV, a*1.602176565e-1, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(ZeV, a*1.602176565e2, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(YeV, a*1.602176565e5, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(u, a*1.660538921e-27, Unit(BasicUnit::kg, 1)) \
+    X(yN, a*1e-24, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(zN, a*1e-21, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(aN, a*1e-18, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(fN, a*1e-15, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(pN, a*1e-12, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(nN, a*1e-9, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(muN, a*1e-6, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(mN, a*1e-3, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(N, a, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(kN, a*1e3, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(MN, a*1e6, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(GN, a*1e9, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(TN, a*1e12, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(PN, a*1e15, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(EN, a*1e18, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(ZN, a*1e21, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(YN, a*1e21, Unit(BasicUnit::kg, 1, BasicUnit::m, 1, BasicUnit::s, -2)) \
+    X(yA, a*1e-24, Unit(BasicUnit::A, 1)) \
+    X(zA, a*1e-21, Unit(BasicUnit::A, 1)) \
+    X(aA, a*1e-18, Unit(BasicUnit::A, 1)) \
+    X(fA, a*1e-15, Unit(BasicUnit::A, 1)) \
+    X(pA, a*1e-12, Unit(BasicUnit::A, 1)) \
+    X(nA, a*1e-9, Unit(BasicUnit::A, 1)) \
+    X(muA, a*1e-6, Unit(BasicUnit::A, 1)) \
+    X(mA, a*1e-3, Unit(BasicUnit::A, 1)) \
+    X(A, a, Unit(BasicUnit::A, 1)) \
+    X(kA, a*1e3, Unit(BasicUnit::A, 1)) \
+    X(MA, a*1e6, Unit(BasicUnit::A, 1)) \
+    X(GA, a*1e9, Unit(BasicUnit::A, 1)) \
+    X(TA, a*1e12, Unit(BasicUnit::A, 1)) \
+    X(PA, a*1e15, Unit(BasicUnit::A, 1)) \
+    X(EA, a*1e18, Unit(BasicUnit::A, 1)) \
+    X(ZA, a*1e21, Unit(BasicUnit::A, 1)) \
+    X(YA, a*1e24, Unit(BasicUnit::A, 1)) \
+    X(K, a, Unit(BasicUnit::K, 1)) \
+    X(mmol, a*1e-3, Unit(BasicUnit::mol, 1)) \
+    X(mol, a, Unit(BasicUnit::mol, 1)) \
+    X(kmol, a*1e3, Unit(BasicUnit::mol, 1)) \
+    X(Cd, a, Unit(BasicUnit::Cd, 1)) \
+    X(rad, a, Unit({})) \
+    X(yHz, a*1e-24, Unit(BasicUnit::s, -1)) \
+    X(zHz, a*1e-21, Unit(BasicUnit::s, -1)) \
+    X(aHz, a*1e-18, Unit(BasicUnit::s, -1)) \
+    X(fHz, a*1e-15, Unit(BasicUnit::s, -1)) \
+    X(pHz, a*1e-12, Unit(BasicUnit::s, -1)) \
+    X(nHz, a*1e-9, Unit(BasicUnit::s, -1)) \
+    X(muHz, a*1e-6, Unit(BasicUnit::s, -1)) \
+    X(mHz, a*1e-3, Unit(BasicUnit::s, -1)) \
+    X(Hz, a, Unit(BasicUnit::s, -1)) \
+    X(kHz, a*1e3, Unit(BasicUnit::s, -1)) \
+    X(MHz, a*1e6, Unit(BasicUnit::s, -1)) \
+    X(GHz, a*1e9, Unit(BasicUnit::s, -1)) \
+    X(THz, a*1e12, Unit(BasicUnit::s, -1)) \
+    X(PHz, a*1e15, Unit(BasicUnit::s, -1)) \
+    X(EHz, a*1e18, Unit(BasicUnit::s, -1)) \
+    X(ZHz, a*1e21, Unit(BasicUnit::s, -1)) \
+    X(YHz, a*1e24, Unit(BasicUnit::s, -1)) \
+    X(yPa, a*1e-24, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(zPa, a*1e-21, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(aPa, a*1e-18, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(fPa, a*1e-15, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(pPa, a*1e-12, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(nPa, a*1e-9, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(muPa, a*1e-6, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(mPa, a*1e-3, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(Pa, a, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(hPa, a*1e2, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(kPa, a*1e3, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(MPa, a*1e6, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(GPa, a*1e9, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(TPa, a*1e12, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(PPa, a*1e15, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(EPa, a*1e18, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(ZPa, a*1e21, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(YPa, a*1e24, Unit(BasicUnit::m, -1, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(yJ, a*1e-24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(zJ, a*1e-21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(aJ, a*1e-18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(fJ, a*1e-15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(pJ, a*1e-12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(nJ, a*1e-9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(muJ, a*1e-6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(mJ, a*1e-3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(J, a, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(kJ, a*1e3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(MJ, a*1e6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(GJ, a*1e9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(TJ, a*1e12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(PJ, a*1e15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(EJ, a*1e18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(ZJ, a*1e21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(YJ, a*1e24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2)) \
+    X(yW, a*1e-24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(zW, a*1e-21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(aW, a*1e-18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(fW, a*1e-15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(pW, a*1e-12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(nW, a*1e-9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(muW, a*1e-6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(mW, a*1e-3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(W, a, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(kW, a*1e3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(MW, a*1e6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(GW, a*1e9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(TW, a*1e12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(PW, a*1e15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(EW, a*1e18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(ZW, a*1e21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(YW, a*1e24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3)) \
+    X(mC, a*1e-3, Unit(BasicUnit::A, 1, BasicUnit::s, 1)) \
+    X(C, a, Unit(BasicUnit::A, 1, BasicUnit::s, 1)) \
+    X(kC, a*1e3, Unit(BasicUnit::A, 1, BasicUnit::s, 1)) \
+    X(yV, a*1e-24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(zV, a*1e-21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(aV, a*1e-18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(fV, a*1e-15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(pV, a*1e-12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(nV, a*1e-9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(muV, a*1e-6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(mV, a*1e-3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(V, a, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(kV, a*1e3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(MV, a*1e6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(GV, a*1e9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(TV, a*1e12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(PV, a*1e15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(EV, a*1e18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(ZV, a*1e21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(YV, a*1e24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -1)) \
+    X(yF, a*1e-24, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(zF, a*1e-21, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(aF, a*1e-18, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(fF, a*1e-15, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(pF, a*1e-12, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(nF, a*1e-9, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(muF, a*1e-6, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(mF, a*1e-3, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(F, a, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(kF, a*1e3, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(MF, a*1e6, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 4, BasicUnit::A, 2)) \
+    X(yohm, a*1e-24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(zohm, a*1e-21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(aohm, a*1e-18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(fohm, a*1e-15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(pohm, a*1e-12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(nohm, a*1e-9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(muohm, a*1e-6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(mohm, a*1e-3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(ohm, a, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(kohm, a*1e3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(Mohm, a*1e6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(Gohm, a*1e9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(Tohm, a*1e12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(Pohm, a*1e15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(Eohm, a*1e18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(Zohm, a*1e21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(Yohm, a*1e24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -3, BasicUnit::A, -2)) \
+    X(S, a, Unit(BasicUnit::m, -2, BasicUnit::kg, -1, BasicUnit::s, 3, BasicUnit::A, 2)) \
+    X(Wb, a, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(yT, a*1e-24, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(zT, a*1e-21, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(aT, a*1e-18, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(fT, a*1e-15, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(pT, a*1e-12, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(nT, a*1e-9, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(muT, a*1e-6, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(mT, a*1e-3, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(T, a, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(kT, a*1e3, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(MT, a*1e6, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(GT, a*1e9, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(TT, a*1e12, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(PT, a*1e15, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(ET, a*1e18, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(ZT, a*1e21, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(YT, a*1e24, Unit(BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -1)) \
+    X(yH, a*1e-24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(zH, a*1e-21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(aH, a*1e-18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(fH, a*1e-15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(pH, a*1e-12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(nH, a*1e-9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(muH, a*1e-6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(mH, a*1e-3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(H, a, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(kH, a*1e3, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(MH, a*1e6, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(GH, a*1e9, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(TH, a*1e12, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(PH, a*1e15, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(EH, a*1e18, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(ZH, a*1e21, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(YH, a*1e24, Unit(BasicUnit::m, 2, BasicUnit::kg, 1, BasicUnit::s, -2, BasicUnit::A, -2)) \
+    X(degC, a-273.15, Unit(BasicUnit::K, 1)) \
+    X(yBc, a*1e-24, Unit(BasicUnit::s, -1)) \
+    X(zBc, a*1e-21, Unit(BasicUnit::s, -1)) \
+    X(aBc, a*1e-18, Unit(BasicUnit::s, -1)) \
+    X(fBc, a*1e-15, Unit(BasicUnit::s, -1)) \
+    X(pBc, a*1e-12, Unit(BasicUnit::s, -1)) \
+    X(nBc, a*1e-9, Unit(BasicUnit::s, -1)) \
+    X(muBc, a*1e-6, Unit(BasicUnit::s, -1)) \
+    X(mBc, a*1e-3, Unit(BasicUnit::s, -1)) \
+    X(Bc, a, Unit(BasicUnit::s, -1)) \
+    X(kBc, a*1e3, Unit(BasicUnit::s, -1)) \
+    X(MBc, a*1e6, Unit(BasicUnit::s, -1)) \
+    X(GBc, a*1e9, Unit(BasicUnit::s, -1)) \
+    X(TBc, a*1e12, Unit(BasicUnit::s, -1)) \
+    X(PBc, a*1e15, Unit(BasicUnit::s, -1)) \
+    X(EBc, a*1e18, Unit(BasicUnit::s, -1)) \
+    X(ZBc, a*1e21, Unit(BasicUnit::s, -1)) \
+    X(YBc, a*1e24, Unit(BasicUnit::s, -1))
+
+#define C11UNITS_DEFINE_LITERAL(suffix, value, unit) \
+    constexpr PhysicalVariable operator "" _##suffix(long double a) \
+    { \
+        return PhysicalVariable(value, unit); \
+    } \
+    constexpr PhysicalVariable operator "" _##suffix(unsigned long long int a) \
+    { \
+        return PhysicalVariable(value, unit); \
+    }
+
+C11UNITS_LITERALS(C11UNITS_DEFINE_LITERAL)
+
+#undef C11UNITS_DEFINE_LITERAL
+
+/// The literals of C11UNITS_LITERALS, available at runtime for parsing text.
+/// A value x written in this unit is scale * x + offset in SI units.
+struct UnitSymbol
+{
+    const char* name;
+    double scale;
+    double offset;
+    Unit unit;
+
+    constexpr PhysicalVariable operator()(const double x) const
+    {
+        return PhysicalVariable(scale * x + offset, unit);
+    }
+
+    /// Returns nullptr for unknown symbols.
+    static const UnitSymbol* find(const std::string& name);
+    static const UnitSymbol* find(const char* name, std::size_t length);
+    static const UnitSymbol* begin();
+    static const UnitSymbol* end();
+};
+
+/// Reads a decimal number like std::from_chars, which C++11 lacks, and
+/// returns the end of it or first if there is none. A leading '+' is allowed.
+const char* parseNumber(const char* first, const char* last, double& value);
+
+/// Parses a number and an optional unit symbol such as "4.7 kohm", "3GeV"
+/// or "120 degSec" into SI units; without a symbol the value is
+/// dimensionless. Anything else after the number is read with parseUnit, so
+/// printed PhysicalVariables parse back. Does not allocate. Throws
+/// UnitParseError with the offset of the first character that does not fit.
+PhysicalVariable parseQuantity(const char* text, std::size_t length);
+
+inline PhysicalVariable parseQuantity(const char* text)
+{
+    return parseQuantity(text, std::strlen(text));
+}
+
+inline PhysicalVariable parseQuantity(const std::string& text)
+{
+    return parseQuantity(text.data(), text.size());
+}
+
+#if __cplusplus >= 201703L
+inline PhysicalVariable parseQuantity(std::string_view text)
+{
+    return parseQuantity(text.data(), text.size());
+}
+#endif
+
+/// The inverse of operator<<(std::ostream&, const Unit&): reads "kg m^2 / s^3",
+/// "Ohm", "1 / m^3" and the Unit::hash() form "A-1kg1m2s-3". Factors are base
+/// symbols, the derived names operator<< prints or literals without a scale
+/// like W, each with an optional exponent; everything after '/' is in the
+/// denominator. Results are cached per thread by the text, so repeated
+/// strings cost a hash and a compare. Throws UnitParseError.
+Unit parseUnit(const char* text, std::size_t length);
+
+inline Unit parseUnit(const char* text)
+{
+    return parseUnit(text, std::strlen(text));
+}
+
+inline Unit parseUnit(const std::string& text)
+{
+    return parseUnit(text.data(), text.size());
+}
+
+#if __cplusplus >= 201703L
+inline Unit parseUnit(std::string_view text)
+{
+    return parseUnit(text.data(), text.size());
+}
+#endif
+
+/// How formatTo writes a value, like printf's %g, %f and %e. A negative
+/// precision gives the shortest text that reads back exactly, or 17 digits
+/// where std::to_chars is not available. With prefix the value is scaled to
+/// [1, 1000) by an SI prefix on the first factor of the unit, e.g.
+/// "523.599 muT" or "299.792 Mm / s"; units whose first factor has an
+/// exponent, like "m^2", are written unscaled.
+struct QuantityFormat
+{
+    enum Notation : unsigned char { general, fixed, scientific };
+
+    constexpr QuantityFormat(Notation notation = general, int precision = 6, bool prefix = false)
+        : notation(notation), precision(precision), prefix(prefix) {}
+
+    Notation notation;
+    int precision;
+    bool prefix;
+};
+
+/// Writes the unit as operator<< does, without the trailing space, to
+/// [first, last). Returns the end of the text, or nullptr if it does not fit.
+char* formatTo(char* first, char* last, Unit unit);
+
+/// Writes "value unit" to [first, last) without allocating, using
+/// std::to_chars where available. The default format gives the text of
+/// operator<< without the trailing space. Returns the end of the text, or
+/// nullptr if it does not fit.
+char* formatTo(char* first, char* last, const PhysicalVariable& pv, QuantityFormat format = QuantityFormat());
+
+/// Stream manipulators turning SI prefixes in operator<< on and off, as
+/// QuantityFormat::prefix does for formatTo: std::cout << siPrefixes << pv.
+std::ostream& siPrefixes(std::ostream& out);
+std::ostream& noSiPrefixes(std::ostream& out);
+
+constexpr auto mu_0 = (1.e-7_H / 1._m) * 4. * M_PI;
 
 #endif // C11UNITS_CPP_INCLUDED